@@ -57,9 +57,12 @@ typedef enum _gna_device_version
 } gna_device_version;
 
 
-/** Maximum number of requests that can be enqueued before retrieval */
+/** Default number of requests that can be in progress at once */
 const uint32_t GNA_REQUEST_QUEUE_LENGTH = 64;
 
+/** Maximum number of requests that can be in progress at once */
+const uint32_t GNA_REQUEST_QUEUE_LENGTH_MAX = 65536;
+
 /******************************************************************************
  * GNA Utilities API
  *****************************************************************************/
@@ -112,6 +112,99 @@ GNA2_API enum Gna2Status Gna2DeviceSetNumberOfThreads(
     uint32_t deviceIndex,
     uint32_t numberOfThreads);
 
+/**
+ Sets dynamic batching of requests processed by software on given device.
+
+ When enabled, a software worker thread coalesces up to maxBatchSize pending requests
+ of the same model into a single batched inference, where supported layers
+ (e.g. fused affine layers) process the inputs of all requests together.
+ Worker waits for more requests up to maxWaitMicroseconds when there are fewer pending.
+ Only requests without hardware consistency, parallel execution,
+ and with buffers independent from each other are coalesced.
+ Results are identical to processing requests separately.
+
+ @note
+    Must be called synchronously.
+
+ @param deviceIndex Index of the affected device.
+ @param maxBatchSize Maximal number of coalesced requests [1,8]. Default is 1 (disabled).
+ @param maxWaitMicroseconds Maximal time worker waits for requests to fill the batch. Default is 0.
+ @return Status of the operation.
+ */
+GNA2_API enum Gna2Status Gna2DeviceSetRequestBatching(
+    uint32_t deviceIndex,
+    uint32_t maxBatchSize,
+    uint32_t maxWaitMicroseconds);
+
+/**
+ Sets maximal number of requests in progress on given device.
+
+ Requests completed but not yet retrieved by Gna2RequestWait()
+ do not count into capacity.
+ When capacity is reached, Gna2RequestEnqueue() waits for completion of any request
+ up to enqueueTimeoutMilliseconds, and fails with Gna2StatusDeviceQueueError afterwards.
+
+ @note
+    Must be called synchronously.
+
+ @param deviceIndex Index of the affected device.
+ @param capacity Maximal number of requests in progress [1,65536]. Default is 64.
+ @param enqueueTimeoutMilliseconds Maximal time Gna2RequestEnqueue() waits for place in queue.
+    Default is 0 (fails immediately when queue is full).
+ @return Status of the operation.
+    @retval Gna2StatusDeviceParameterOutOfRange Capacity is out of range.
+ */
+GNA2_API enum Gna2Status Gna2DeviceSetRequestQueueCapacity(
+    uint32_t deviceIndex,
+    uint32_t capacity,
+    uint32_t enqueueTimeoutMilliseconds);
+
+/**
+ Pins software worker threads of given device to CPUs.
+
+ Worker thread i runs only on CPU cpuIndices[i % cpuCount].
+ Worker threads are restarted and allocate their buffers after being pinned,
+ thus on NUMA systems buffers are placed in memory local to CPU of the worker.
+ Affinity is kept when number of threads is changed.
+ Threads calling Gna2RequestWait() are not affected.
+
+ @note
+    Must be called synchronously.
+
+ @param deviceIndex Index of the affected device.
+ @param cpuCount Number of CPU indices. Zero removes affinity (default).
+ @param cpuIndices Array of cpuCount zero-based indices of CPUs available to the process.
+ @return Status of the operation.
+    @retval Gna2StatusSuccess Worker threads were pinned.
+    @retval Gna2StatusDeviceParameterOutOfRange Any of CPUs is not available, previous affinity is kept.
+ */
+GNA2_API enum Gna2Status Gna2DeviceSetThreadAffinity(
+    uint32_t deviceIndex,
+    uint32_t cpuCount,
+    uint32_t const * cpuIndices);
+
+/**
+ Sets repacking of weights of models created afterwards on given device.
+
+ When enabled, 2B weights and biases of fully connected affine layers
+ with 2B inputs are copied at model creation into layout of SIMD panels,
+ processed by software with fewer cache misses and horizontal additions.
+ Results are identical to unpacked weights.
+ Hardware consistency modes use model weights directly.
+
+ @note
+    Must be called synchronously.
+    Packed weights are snapshot of model weights,
+    thus changes of model weights after model creation are not observed.
+
+ @param deviceIndex Index of the affected device.
+ @param enabled Non-zero to enable packing. Default is 0 (disabled).
+ @return Status of the operation.
+ */
+GNA2_API enum Gna2Status Gna2DeviceSetWeightPacking(
+    uint32_t deviceIndex,
+    uint32_t enabled);
+
 #endif // __GNA2_DEVICE_API_H
 
 /**
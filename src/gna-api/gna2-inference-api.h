@@ -217,6 +217,137 @@ GNA2_API enum Gna2Status Gna2RequestConfigSetAccelerationMode(
     uint32_t requestConfigId,
     enum Gna2AccelerationMode accelerationMode);
 
+/**
+ Enables splitting of single request processing across device threads.
+
+ When enabled, software inference of large layers (e.g. affine output rows)
+ is partitioned between the thread processing the request and idle device threads,
+ that synchronize before processing next layer.
+ Software requests are processed one at a time, thus idle device threads
+ contribute to request processing only with parallel execution enabled.
+ Has no effect for ::Gna2AccelerationModeHardware and single-threaded device.
+ @see Gna2DeviceSetNumberOfThreads.
+
+ @param requestConfigId Identifier of affected request configuration.
+ @return Status of the operation.
+ */
+GNA2_API enum Gna2Status Gna2RequestConfigEnableParallelExecution(
+    uint32_t requestConfigId);
+
+/**
+ Priority of processing requests by device threads.
+ */
+enum Gna2RequestPriority
+{
+    /**
+     Processed when no request of higher priority is pending, e.g. offline rescoring.
+     */
+    Gna2RequestPriorityLow = 0,
+
+    /**
+     Default priority.
+     */
+    Gna2RequestPriorityNormal = 1,
+
+    /**
+     Processed before requests of low and normal priority.
+     */
+    Gna2RequestPriorityHigh = 2,
+
+    /**
+     Processed before all other requests, e.g. latency critical streaming.
+     */
+    Gna2RequestPriorityRealTime = 3,
+};
+
+/**
+ Sets priority of requests created with given configuration.
+
+ Pending requests are taken by device threads strictly in order of priority,
+ requests of the same priority in order of deadlines, @see Gna2RequestConfigSetDeadline,
+ requests without deadline are processed after ones with deadline in order of enqueuing.
+ Request already in progress is not preempted.
+ When not set ::Gna2RequestPriorityNormal is used.
+
+ @param requestConfigId Identifier of affected request configuration.
+ @param priority Priority of requests.
+ @return Status of the operation.
+ */
+GNA2_API enum Gna2Status Gna2RequestConfigSetPriority(
+    uint32_t requestConfigId,
+    enum Gna2RequestPriority priority);
+
+/**
+ Sets deadline of requests created with given configuration.
+
+ Deadline of each request is an absolute time point, set at Gna2RequestEnqueue()
+ to the time of enqueuing increased by given number of microseconds.
+ Pending requests of the same priority are processed earliest deadline first.
+ Request completed after its deadline is still completed,
+ the miss is reported by ::Gna2InstrumentationPointLibDeadlineMiss.
+
+ @param requestConfigId Identifier of affected request configuration.
+ @param microseconds Relative deadline of requests. Zero (default) disables the deadline.
+ @return Status of the operation.
+ */
+GNA2_API enum Gna2Status Gna2RequestConfigSetDeadline(
+    uint32_t requestConfigId,
+    uint32_t microseconds);
+
+/**
+ Callback invoked when request processing is completed.
+
+ @param requestId Identifier of the completed request.
+ @param status Status of request processing, as returned by Gna2RequestWait().
+ @param userData Pointer provided with Gna2RequestConfigSetCompletionCallback().
+ */
+typedef void (*Gna2RequestCompletionCallback)(
+    uint32_t requestId,
+    enum Gna2Status status,
+    void * userData);
+
+/**
+ Sets callback invoked after each request created with given configuration is completed.
+
+ Callback is invoked by library thread that completed the request,
+ possibly before Gna2RequestEnqueue() of the request returns.
+ Request has to be retrieved with Gna2RequestWait() nevertheless,
+ which returns immediately when called from the callback.
+ Other threads can retrieve the request only after the callback returns.
+ Callback should return quickly, as it delays processing of other requests.
+
+ @param requestConfigId Identifier of affected request configuration.
+ @param callback Callback to invoke or NULL (default) to disable.
+ @param userData Pointer passed to callback.
+ @return Status of the operation.
+ */
+GNA2_API enum Gna2Status Gna2RequestConfigSetCompletionCallback(
+    uint32_t requestConfigId,
+    Gna2RequestCompletionCallback callback,
+    void * userData);
+
+/**
+ Sets event signaled after each request created with given configuration is completed.
+
+ Library adds 1 to the counter of given Linux eventfd when request is completed,
+ so that completion can be awaited with poll(), select() or epoll together with other events.
+ Completed requests are retrieved with Gna2RequestWait() with zero timeout.
+ Event is signaled before the request can be retrieved,
+ thus event descriptor owned by the user has to stay open only until the request is retrieved.
+
+ @note
+    Supported only on Linux.
+
+ @param requestConfigId Identifier of affected request configuration.
+ @param eventFd Descriptor of eventfd or -1 (default) to disable.
+ @return Status of the operation.
+    @retval Gna2StatusSuccess Event was set.
+    @retval Gna2StatusNotImplemented Events are not supported on the platform.
+ */
+GNA2_API enum Gna2Status Gna2RequestConfigSetCompletionEvent(
+    uint32_t requestConfigId,
+    int eventFd);
+
 /**
  Releases request config and its resources.
 
@@ -236,7 +367,8 @@ GNA2_API enum Gna2Status Gna2RequestConfigRelease(
  @note
  - Request's life cycle and memory is managed by GNA.
  - The model, that the request will be calculated against is provided by configuration.
- - Maximum number of requests that can wait in the queue at once is 64.
+ - Maximum number of requests in progress at once is 64 by default,
+   see Gna2DeviceSetRequestQueueCapacity().
 
  @param requestConfigId The request configuration.
  @param [out] requestId Identifier of the enqueued request.
@@ -267,6 +399,38 @@ GNA2_API enum Gna2Status Gna2RequestWait(
     uint32_t requestId,
     uint32_t timeoutMilliseconds);
 
+/**
+ Waits for processing of any of the requests to be completed.
+
+ Returns all of the requests completed when the wait ends,
+ that are released as if retrieved by Gna2RequestWait().
+ Requests not completed are left for subsequent waits.
+
+ @note
+ - All requests have to be enqueued on the same device.
+
+ @param numberOfRequests Number of requests to wait for.
+ @param requestIds Array of numberOfRequests requests to wait for.
+ @param timeoutMilliseconds Timeout duration in milliseconds.
+ @param [out] numberOfCompleted Number of completed requests.
+ @param [out] completedRequestIds Array of at least numberOfRequests elements
+    to store identifiers of completed requests in.
+ @param [out] completedStatuses Array of at least numberOfRequests elements
+    to store statuses of processing of completed requests in,
+    in the same order as completedRequestIds.
+ @return Status of the wait.
+    @retval Gna2StatusSuccess At least one request was completed.
+    @retval Gna2StatusWarningDeviceBusy None of requests was completed before the timeout expired.
+    @retval Gna2StatusIdentifierInvalid Any of requests is not pending.
+ */
+GNA2_API enum Gna2Status Gna2RequestWaitAny(
+    uint32_t numberOfRequests,
+    uint32_t const * requestIds,
+    uint32_t timeoutMilliseconds,
+    uint32_t * numberOfCompleted,
+    uint32_t * completedRequestIds,
+    enum Gna2Status * completedStatuses);
+
 #endif // __GNA2_INFERENCE_API_H
 
 /**
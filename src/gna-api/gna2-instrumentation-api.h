@@ -113,6 +113,14 @@ enum Gna2InstrumentationPoint
      @warning This event always provides time duration instead of time point.
      */
     Gna2InstrumentationPointHwStallCycles = 14,
+
+    /**
+     Request deadline miss, from library instrumentation.
+     1 when request execution was completed after its deadline, 0 otherwise.
+     @see Gna2RequestConfigSetDeadline.
+     @warning This event always provides flag instead of time point.
+     */
+    Gna2InstrumentationPointLibDeadlineMiss = 15,
 };
 
 /**
@@ -130,7 +138,7 @@ enum Gna2InstrumentationPoint
  @see Gna2RequestConfigSetInstrumentationMode and Gna2InstrumentationMode
     for description of hardware instrumentation.
 
- @param numberOfInstrumentationPoints A number of selected instrumentation points. Must be in range <1, 15>.
+ @param numberOfInstrumentationPoints A number of selected instrumentation points. Must be in range <1, 16>.
  @param selectedInstrumentationPoints An array of selected instrumentation points.
  @param results Buffer to save instrumentation results to.
     Result buffer size have to be at least numberOfInstrumentationPoints * sizeof(uint64_t).
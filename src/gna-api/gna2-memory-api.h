@@ -31,6 +31,9 @@
 /**
  Allocates memory buffer, that can be used with GNA device.
 
+ Buffers are sub-allocated from 2MB regions shared by subsequent allocations,
+ see Gna2MemorySetHugePages().
+
  @param sizeRequested Buffer size desired by the caller. Must be within range <1, 2^28>.
  @param [out] sizeGranted Buffer size granted by GNA,
                       can be more then requested due to HW constraints.
@@ -44,6 +47,24 @@ GNA2_API enum Gna2Status Gna2MemoryAlloc(
     uint32_t * sizeGranted,
     void ** memoryAddress);
 
+/**
+ Sets backing of memory regions allocated afterwards by 2MB huge pages.
+
+ Reserved huge pages (MAP_HUGETLB) are used when available,
+ otherwise transparent huge pages are requested for 2MB aligned regions.
+ Reduces TLB misses when large weight tensors are processed by software.
+ Buffers allocated before are not affected.
+
+ @note
+    Linux only.
+
+ @param enabled Non-zero to enable huge pages. Default is 0 (disabled).
+ @return Status of the operation.
+    @retval Gna2StatusNotImplemented On Windows when enabled.
+ */
+GNA2_API enum Gna2Status Gna2MemorySetHugePages(
+    uint32_t enabled);
+
 /**
  Releases memory buffer.
 
@@ -0,0 +1,681 @@
+/**
+ @copyright (C) 2021 Intel Corporation
+ SPDX-License-Identifier: LGPL-2.1-or-later
+ */
+
+//*****************************************************************************
+// gna-bench.cpp - micro-benchmark of software kernels
+//
+// Times every entry of AccelerationDetector::Kernels for each operation,
+// data mode and acceleration mode supported by the CPU over set of typical shapes.
+// Kernel entries that are the very same function as generic kernel
+// are marked as generic fallbacks.
+//
+// Usage: gna-bench [--filter <operation name part>] [--time <minimum ms per measurement>]
+//
+
+#include "AccelerationDetector.h"
+#include "HardwareCapabilities.h"
+#include "KernelArguments.h"
+#include "XnnKernel.h"
+#include "gmm.h"
+#include "pwl.h"
+
+#include "common.h"
+#include "gna-api-types-gmm.h"
+#include "gna-api-types-xnn.h"
+#include "gna2-common-impl.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace GNA;
+
+namespace
+{
+
+struct BenchOptions
+{
+    std::string Filter;
+    uint32_t MinimumTimeMs = 10;
+};
+
+// Kernel entry being measured
+struct BenchKernel
+{
+    kernel_op Operation;
+    KernelMode const & Mode;
+    AccelerationMode const & Acceleration;
+    VoidKernel Kernel;
+    bool IsGenericFallback;
+};
+
+/**
+ * Memory of single kernel operand aligned for SIMD loads
+ * and filled with small pseudo-random values
+ */
+class BenchBuffer
+{
+public:
+    explicit BenchBuffer(size_t size) :
+        storage(size + alignment)
+    {
+        auto const address = reinterpret_cast<uintptr_t>(storage.data());
+        data = storage.data() + (alignment - address % alignment) % alignment;
+        std::mt19937 generator{ static_cast<uint32_t>(size) };
+        std::uniform_int_distribution<int> distribution{ 0, 15 };
+        for (size_t i = 0; i < size; i++)
+        {
+            data[i] = static_cast<int8_t>(distribution(generator));
+        }
+    }
+
+    template<typename T = int8_t>
+    T * Get() const
+    {
+        return reinterpret_cast<T *>(data);
+    }
+
+private:
+    static constexpr size_t alignment = 64;
+
+    std::vector<int8_t> storage;
+    int8_t * data;
+};
+
+uint32_t getBytes(gna_data_mode mode)
+{
+    switch (mode)
+    {
+    case GNA_INT8:
+    case GNA_UINT8:
+        return 1;
+    case GNA_INT16:
+    case GNA_UINT16:
+        return 2;
+    case GNA_DATA_RICH_FORMAT:
+        return 8;
+    default:
+        return 4;
+    }
+}
+
+char const * getModeName(gna_data_mode mode)
+{
+    switch (mode)
+    {
+    case GNA_INT8:
+        return "i8";
+    case GNA_INT16:
+        return "i16";
+    case GNA_INT32:
+        return "i32";
+    case GNA_UINT8:
+        return "u8";
+    case GNA_UINT16:
+        return "u16";
+    case GNA_UINT32:
+        return "u32";
+    case GNA_DATA_ACTIVATION_DISABLED:
+        return "noact";
+    default:
+        return "?";
+    }
+}
+
+char const * getBiasName(nn_bias_mode mode)
+{
+    switch (mode)
+    {
+    case GNA_BIAS_MODE_RICH_FORMAT:
+        return "rich";
+    case GNA_BIAS_MODE_CONSTANT_SCALAR:
+        return "scalar";
+    case GNA_BIAS_MODE_DISABLED:
+        return "none";
+    default:
+        return "simple";
+    }
+}
+
+char const * getOperationName(kernel_op operation)
+{
+    switch (operation)
+    {
+    case KERNEL_AFFINE:
+        return "affine";
+    case KERNEL_AFFINE_AL:
+        return "affine-al";
+    case KERNEL_AFFINE_DIAGONAL:
+        return "diagonal";
+    case KERNEL_AFFINE_MULTIBIAS:
+        return "multibias";
+    case KERNEL_RECURRENT:
+        return "recurrent";
+    case KERNEL_CONVOLUTIONAL:
+        return "cnn1d";
+    case KERNEL_POOLING:
+        return "cnn1d-pool";
+    case KERNEL_CONVOLUTIONAL_2D:
+        return "cnn2d";
+    case KERNEL_POOLING_2D:
+        return "pool2d";
+    case KERNEL_PWL:
+        return "pwl";
+    case KERNEL_COPY:
+        return "copy";
+    case KERNEL_TRANSPOSE:
+        return "transpose";
+    case KERNEL_GMM:
+        return "gmm";
+    case KERNEL_GMM_AL:
+        return "gmm-al";
+    default:
+        return "other";
+    }
+}
+
+// Buffer element counts of GNA 3.0 are used as only those cover 1B input kernels
+class Bench
+{
+public:
+    explicit Bench(BenchOptions const & optionsIn) :
+        options{ optionsIn },
+        execution{ &buffers, &saturationCount,
+            HardwareCapabilities::GetHardwareConsistencySettings(Gna2DeviceVersionFromInt(0x30)) },
+        supportedAccelerations{ AccelerationDetector{}.GetSupportedCpuAccelerations() }
+    {
+    }
+
+    void Run()
+    {
+        printf("%-12s %-18s %-14s %-32s %14s %10s\n",
+            "operation", "mode", "acceleration", "shape", "ns/call", "GOPS");
+        for (auto const & operation : AccelerationDetector::Kernels)
+        {
+            if (!options.Filter.empty()
+                && std::string{ getOperationName(operation.first) }.find(options.Filter) == std::string::npos)
+            {
+                continue;
+            }
+            for (auto const & mode : operation.second)
+            {
+                for (auto const & kernel : mode.second)
+                {
+                    if (!isSupported(kernel.first))
+                    {
+                        continue;
+                    }
+                    auto const & generic = mode.second.at(
+                        AccelerationMode{ Gna2AccelerationModeGeneric, kernel.first.GetHwConsistency() });
+                    auto const isFallback = Gna2AccelerationModeGeneric != kernel.first.GetMode()
+                        && generic == kernel.second;
+                    run(BenchKernel{ operation.first, mode.first, kernel.first, kernel.second, isFallback });
+                }
+            }
+        }
+    }
+
+private:
+    bool isSupported(AccelerationMode const & accel) const
+    {
+        return supportedAccelerations.cend() != std::find(supportedAccelerations.cbegin(),
+            supportedAccelerations.cend(), accel.GetMode());
+    }
+
+    void run(BenchKernel const & kernel)
+    {
+        switch (kernel.Operation)
+        {
+        case KERNEL_AFFINE:
+        case KERNEL_AFFINE_AL:
+        case KERNEL_AFFINE_DIAGONAL:
+        case KERNEL_AFFINE_MULTIBIAS:
+            benchAffine(kernel);
+            break;
+        case KERNEL_RECURRENT:
+            benchRecurrent(kernel);
+            break;
+        case KERNEL_CONVOLUTIONAL:
+        case KERNEL_POOLING:
+            benchConvolution(kernel);
+            break;
+        case KERNEL_CONVOLUTIONAL_2D:
+            benchConvolution2D(kernel);
+            break;
+        case KERNEL_POOLING_2D:
+            benchPooling2D(kernel);
+            break;
+        case KERNEL_PWL:
+            benchActivation(kernel);
+            break;
+        case KERNEL_COPY:
+        case KERNEL_TRANSPOSE:
+            benchCopy(kernel);
+            break;
+        case KERNEL_GMM:
+        case KERNEL_GMM_AL:
+            benchGmm(kernel);
+            break;
+        default:
+            break;
+        }
+    }
+
+    // Calls kernel repeatedly, doubling iteration count until minimum time is reached
+    double measure(std::function<void()> const & call) const
+    {
+        call();
+        uint64_t iterations = 1;
+        while (true)
+        {
+            auto const start = std::chrono::steady_clock::now();
+            for (uint64_t i = 0; i < iterations; i++)
+            {
+                call();
+            }
+            auto const elapsed = std::chrono::duration<double, std::nano>(
+                std::chrono::steady_clock::now() - start).count();
+            if (elapsed >= options.MinimumTimeMs * 1e6 || iterations >= (UINT64_C(1) << 32))
+            {
+                return elapsed / static_cast<double>(iterations);
+            }
+            iterations *= 2;
+        }
+    }
+
+    // Reports single measurement, operations count multiply-adds as two operations
+    void report(BenchKernel const & kernel, std::string const & shape, double operations,
+        std::function<void()> const & call) const
+    {
+        auto const nanoseconds = measure(call);
+        auto const mode = std::string{ getModeName(kernel.Mode.Input) } + "/"
+            + getModeName(kernel.Mode.Weight) + "/" + getBiasName(kernel.Mode.Bias);
+        printf("%-12s %-18s %-14s %-32s %14.1f %10.3f%s\n",
+            getOperationName(kernel.Operation), mode.c_str(), kernel.Acceleration.GetName(),
+            shape.c_str(), nanoseconds, operations / nanoseconds,
+            kernel.IsGenericFallback ? "  generic fallback" : "");
+    }
+
+    static std::string shapeName(char const * format, uint32_t a, uint32_t b, uint32_t c = 0, uint32_t d = 0)
+    {
+        char name[64];
+        snprintf(name, sizeof(name), format, a, b, c, d);
+        return name;
+    }
+
+    void benchAffine(BenchKernel const & kernel)
+    {
+        auto const inputBytes = getBytes(kernel.Mode.Input);
+        auto const weightBytes = getBytes(kernel.Mode.Weight);
+        auto const biasBytes = GNA_BIAS_MODE_RICH_FORMAT == kernel.Mode.Bias ? 8u : 4u;
+        uint32_t const multiBiasVectorCount = 4;
+        auto const isDiagonal = KERNEL_AFFINE_DIAGONAL == kernel.Operation;
+
+        for (uint32_t const outputs : { 256u, 1024u })
+        {
+            for (uint32_t const inputs : { 256u, 1024u })
+            {
+                if (isDiagonal && inputs != outputs)
+                {
+                    continue;
+                }
+                for (uint32_t const vectors : { 1u, 2u, 4u, 8u })
+                {
+                    BenchBuffer const input{ inputs * vectors * inputBytes };
+                    BenchBuffer const output{ outputs * vectors * sizeof(int32_t) };
+                    BenchBuffer const weights{ outputs * (isDiagonal ? 1 : inputs) * weightBytes };
+                    BenchBuffer const biases{ outputs * 8 };
+                    BenchBuffer const multiBias{ outputs * multiBiasVectorCount * sizeof(int32_t) };
+                    BenchBuffer indices{ outputs * sizeof(uint32_t) };
+
+                    auto const isMulti = KERNEL_AFFINE_MULTIBIAS == kernel.Operation;
+                    auto const transform = AffineConfig{ outputs, vectors, inputs, input.Get<int16_t>(),
+                        output.Get<int32_t>(), weights.Get(), biases.Get(),
+                        isMulti ? multiBias.Get() : nullptr, isMulti ? multiBiasVectorCount : 0,
+                        isMulti ? 4 : biasBytes };
+                    auto requestConfig = KernelConfig<AffineConfig>{ transform,
+                        BaseConfig{ BaseAddress{ input.Get() }, BaseAddress{ output.Get() } } };
+                    auto const config = ExecutionKernelConfig<AffineConfig>{ &requestConfig, execution };
+
+                    auto const rows = KERNEL_AFFINE_AL == kernel.Operation ? outputs / 4 : outputs;
+                    auto const shape = shapeName("M%u K%u N%u", rows, inputs, vectors);
+                    if (KERNEL_AFFINE_AL == kernel.Operation)
+                    {
+                        for (uint32_t i = 0; i < rows; i++)
+                        {
+                            indices.Get<uint32_t>()[i] = i * 4;
+                        }
+                        auto const al = AffineConfigAl{ indices.Get<uint32_t>(), rows };
+                        auto const affineAl = reinterpret_cast<AffineActiveListKernel>(kernel.Kernel);
+                        report(kernel, shape, 2.0 * rows * inputs * vectors, [&]() { affineAl(&config, al); });
+                    }
+                    else
+                    {
+                        auto const affine = reinterpret_cast<AffineKernel>(kernel.Kernel);
+                        auto const operations = 2.0 * outputs * (isDiagonal ? 1 : inputs) * vectors;
+                        report(kernel, shape, operations, [&]() { affine(&config); });
+                    }
+                }
+            }
+        }
+    }
+
+    void benchRecurrent(BenchKernel const & kernel)
+    {
+        auto const inputBytes = getBytes(kernel.Mode.Input);
+        auto const weightBytes = getBytes(kernel.Mode.Weight);
+        auto const biasBytes = GNA_BIAS_MODE_RICH_FORMAT == kernel.Mode.Bias ? 8u : 4u;
+        auto const pwl = createPwl(16);
+
+        for (uint32_t const outputs : { 128u, 512u })
+        {
+            for (uint32_t const inputs : { 128u, 512u })
+            {
+                for (uint32_t const vectors : { 1u, 4u, 8u })
+                {
+                    BenchBuffer const input{ inputs * vectors * inputBytes };
+                    BenchBuffer const output{ outputs * vectors * sizeof(int32_t) };
+                    // activated outputs of previous vector are fed back
+                    BenchBuffer const activated{ outputs * (vectors + 1) * sizeof(int16_t) };
+                    BenchBuffer const weights{ outputs * (inputs + outputs) * weightBytes };
+                    BenchBuffer const biases{ outputs * 8 };
+
+                    auto const transform = RecurrentConfig{ outputs, vectors, inputs, input.Get<int16_t>(),
+                        activated.Get<int16_t>(), output.Get<int32_t>(), activated.Get<int16_t>() + outputs,
+                        weights.Get(), biases.Get(), biasBytes, sizeof(int16_t),
+                        ActivationConfig{ outputs, &pwl } };
+                    auto requestConfig = KernelConfig<RecurrentConfig>{ transform,
+                        BaseConfig{ BaseAddress{ input.Get() }, BaseAddress{ activated.Get<int16_t>() + outputs } } };
+                    auto const config = ExecutionKernelConfig<RecurrentConfig>{ &requestConfig, execution };
+                    auto const recurrent = reinterpret_cast<RecurrentKernel>(kernel.Kernel);
+
+                    report(kernel, shapeName("M%u K%u N%u", outputs, inputs, vectors),
+                        2.0 * outputs * (inputs + outputs) * vectors, [&]() { recurrent(&config); });
+                }
+            }
+        }
+    }
+
+    void benchConvolution(BenchKernel const & kernel)
+    {
+        auto const inputBytes = getBytes(kernel.Mode.Input);
+        uint32_t const inputCount = 1536;
+        uint32_t const stride = 8;
+        auto const pwl = createPwl(16);
+
+        for (uint32_t const filters : { 16u, 128u })
+        {
+            for (uint32_t const coefficients : { 48u, 96u })
+            {
+                auto const outputsPerFilter = (inputCount - coefficients) / stride + 1;
+                BenchBuffer const input{ inputCount * inputBytes };
+                BenchBuffer const output{ filters * outputsPerFilter * sizeof(int32_t) };
+                BenchBuffer const filterData{ filters * coefficients * inputBytes };
+                BenchBuffer const biases{ filters * sizeof(int32_t) };
+
+                auto const source = ConvolutionConfig{ stride, outputsPerFilter, filters, coefficients,
+                    input.Get<int16_t>(), filterData.Get<int16_t>(), biases.Get<nn_bias_s>(),
+                    output.Get<int32_t>(), sizeof(int32_t), inputBytes };
+                auto const config = ConvolutionConfig{ &source, execution };
+                auto const shape = shapeName("F%u C%u S%u W%u", filters, coefficients, stride, inputCount);
+                auto const operations = 2.0 * filters * coefficients * outputsPerFilter;
+
+                if (KERNEL_POOLING == kernel.Operation)
+                {
+                    auto const poolingKernel = reinterpret_cast<ConvolutionPoolingKernel>(kernel.Kernel);
+                    auto const hiddenPooling = PoolingConfig{ KernelPoolingModeMax, 3, 2 };
+                    auto const pooling = PoolingConfig{ &hiddenPooling, buffers.pool };
+                    report(kernel, shape + " max3/2", operations,
+                        [&]() { poolingKernel(&config, &pooling, &pwl); });
+                }
+                else
+                {
+                    auto const convolution = reinterpret_cast<ConvolutionKernel>(kernel.Kernel);
+                    report(kernel, shape, operations, [&]() { convolution(&config); });
+                }
+            }
+        }
+    }
+
+    void benchConvolution2D(BenchKernel const & kernel)
+    {
+        auto const inputBytes = getBytes(kernel.Mode.Input);
+        auto const filterBytes = getBytes(kernel.Mode.Weight);
+        uint32_t const width = 32;
+        uint32_t const height = 32;
+
+        for (uint32_t const depth : { 8u, 32u })
+        {
+            for (uint32_t const filterSize : { 1u, 3u, 5u })
+            {
+                for (uint32_t const filters : { 16u, 64u })
+                {
+                    auto const outWidth = width - filterSize + 1;
+                    auto const outHeight = height - filterSize + 1;
+                    // filters are padded to 16B in memory
+                    auto const filterStride = RoundUp(filterSize * filterSize * depth * filterBytes, 16u);
+                    BenchBuffer const input{ width * height * depth * inputBytes };
+                    BenchBuffer const output{ outWidth * outHeight * filters * sizeof(int32_t) };
+                    BenchBuffer const filterData{ filters * filterStride };
+                    BenchBuffer const biases{ filters * sizeof(int32_t) };
+
+                    auto const transform = ConvolutionConfig2D{ width, height, depth, filters,
+                        filterSize, filterSize, depth, KernelDataMode{ filterBytes }, filterData.Get(), 1, 1, 0, 0,
+                        KernelBiasModePerFilter, KernelDataMode{ sizeof(int32_t) }, biases.Get() };
+                    auto requestConfig = KernelConfig<ConvolutionConfig2D>{ transform,
+                        BaseConfig{ BaseAddress{ input.Get() }, BaseAddress{ output.Get() } } };
+                    auto const config = ExecutionKernelConfig<ConvolutionConfig2D>{ &requestConfig, execution };
+                    auto const convolution = reinterpret_cast<ConvolutionKernel2D>(kernel.Kernel);
+
+                    report(kernel, shapeName("%ux%ux%u F%u", width, height, depth, filters)
+                        + shapeName(" %ux%u", filterSize, filterSize),
+                        2.0 * outWidth * outHeight * filters * filterSize * filterSize * depth,
+                        [&]() { convolution(&config); });
+                }
+            }
+        }
+    }
+
+    void benchPooling2D(BenchKernel const & kernel)
+    {
+        uint32_t const width = 32;
+        uint32_t const height = 32;
+
+        for (uint32_t const depth : { 16u, 64u })
+        {
+            for (auto const mode : { KernelPoolingModeMax, KernelPoolingModeSum })
+            {
+                for (uint32_t const window : { 2u, 3u })
+                {
+                    // 4B elements are allocated for every data mode
+                    BenchBuffer const input{ width * height * depth * sizeof(int32_t) };
+                    BenchBuffer const output{ width * height * depth * sizeof(int32_t) };
+                    auto const transform = PoolingConfig2D{ width, height, depth, mode, 2, 2, window, window };
+                    auto requestConfig = KernelConfig<PoolingConfig2D>{ transform,
+                        BaseConfig{ BaseAddress{ input.Get() }, BaseAddress{ output.Get() } } };
+                    auto const config = ExecutionKernelConfig<PoolingConfig2D>{ &requestConfig, execution };
+                    auto const pooling = reinterpret_cast<PoolingKernel2D>(kernel.Kernel);
+                    auto const outWidth = (width - window + 1) / 2 + 1;
+                    auto const outHeight = (height - window + 1) / 2 + 1;
+
+                    report(kernel, shapeName("%ux%ux%u", width, height, depth)
+                        + shapeName(KernelPoolingModeMax == mode ? " max%ux%u/2" : " sum%ux%u/2", window, window),
+                        1.0 * outWidth * outHeight * depth * window * window, [&]() { pooling(&config); });
+                }
+            }
+        }
+    }
+
+    void benchActivation(BenchKernel const & kernel)
+    {
+        for (uint32_t const segments : { 16u, 128u })
+        {
+            auto const pwl = createPwl(segments);
+            for (uint32_t const elements : { 1024u, 8192u })
+            {
+                BenchBuffer const input{ elements * sizeof(int32_t) };
+                BenchBuffer const output{ elements * sizeof(int16_t) };
+                auto requestConfig = KernelConfig<ActivationConfig>{ ActivationConfig{ elements, &pwl },
+                    BaseConfig{ BaseAddress{ input.Get() }, BaseAddress{ output.Get() } } };
+                auto const config = ExecutionKernelConfig<ActivationConfig>{ &requestConfig, execution };
+                auto const activation = reinterpret_cast<ActivationKernel>(kernel.Kernel);
+
+                report(kernel, shapeName("E%u S%u", elements, segments), elements,
+                    [&]() { activation(&config); });
+            }
+        }
+    }
+
+    // Operations of copy and transpose are elements moved
+    void benchCopy(BenchKernel const & kernel)
+    {
+        auto const bytes = getBytes(kernel.Mode.Input);
+        // interleave, deinterleave and square shapes
+        std::pair<uint32_t, uint32_t> const shapes[] = { { 1, 1024 }, { 2, 1024 }, { 8, 1024 }, { 2, 8192 },
+            { 8, 8192 }, { 1024, 2 }, { 1024, 8 }, { 8192, 3 }, { 8192, 8 }, { 100, 100 }, { 1024, 1024 } };
+        for (auto const & dimensions : shapes)
+        {
+            auto const rows = dimensions.first;
+            auto const columns = dimensions.second;
+            BenchBuffer const input{ rows * columns * bytes };
+            BenchBuffer const output{ rows * columns * bytes };
+            auto const shape = shapeName("H%u W%u", rows, columns);
+            if (KERNEL_COPY == kernel.Operation)
+            {
+                auto const config = CopyConfig{ rows, columns, columns, columns,
+                    input.Get<int16_t>(), output.Get<int16_t>() };
+                auto const copy = reinterpret_cast<CopyKernel>(kernel.Kernel);
+                report(kernel, shape, 1.0 * rows * columns, [&]() { copy(&config); });
+            }
+            else
+            {
+                auto const config = TransposeConfig{ rows, columns, input.Get<int16_t>(), output.Get<int16_t>() };
+                auto const transpose = reinterpret_cast<TransposeKernel>(kernel.Kernel);
+                report(kernel, shape, 1.0 * rows * columns, [&]() { transpose(&config); });
+            }
+        }
+    }
+
+    // Operations of GMM are difference, product with inverse covariance and accumulation per element
+    void benchGmm(BenchKernel const & kernel)
+    {
+        auto const varBytes = getBytes(kernel.Mode.Weight);
+        uint32_t const features = 40;
+        auto const featureOffset = RoundUp(features, 64u);
+
+        for (uint32_t const mixtures : { 1u, 8u })
+        {
+            for (uint32_t const states : { 512u, 4096u })
+            {
+                for (uint32_t const vectors : { 1u, 8u })
+                {
+                    auto const meanSetSize = mixtures * features * GMM_MEAN_VALUE_SIZE;
+                    auto const varSetSize = mixtures * features * varBytes;
+                    auto const constSetSize = RoundUp(mixtures, 2u) * GMM_CONSTANTS_SIZE;
+                    BenchBuffer const input{ featureOffset * vectors };
+                    BenchBuffer const output{ states * vectors * GMM_SCORE_SIZE };
+                    BenchBuffer const means{ states * meanSetSize };
+                    BenchBuffer const vars{ states * varSetSize };
+                    BenchBuffer const constants{ states * constSetSize };
+                    BenchBuffer indices{ states * sizeof(uint32_t) };
+
+                    auto const transform = GmmConfig{ vectors, features, mixtures, meanSetSize, varSetSize,
+                        constSetSize, UINT32_MAX, states, means.Get<uint8_t>(), vars.Get<uint8_t>(),
+                        constants.Get<uint32_t>() };
+                    auto requestConfig = KernelConfig<GmmConfig>{ transform,
+                        BaseConfig{ BaseAddress{ input.Get() }, BaseAddress{ output.Get() } } };
+                    auto const config = ExecutionKernelConfig<GmmConfig>{ &requestConfig, execution };
+
+                    auto const activeStates = KERNEL_GMM_AL == kernel.Operation ? states / 2 : states;
+                    auto const shape = shapeName("F%u M%u S%u N%u", features, mixtures, activeStates, vectors);
+                    auto const operations = 3.0 * features * mixtures * activeStates * vectors;
+                    if (KERNEL_GMM_AL == kernel.Operation)
+                    {
+                        for (uint32_t i = 0; i < activeStates; i++)
+                        {
+                            indices.Get<uint32_t>()[i] = i * 2;
+                        }
+                        auto const al = AffineConfigAl{ indices.Get<uint32_t>(), activeStates };
+                        auto const gmmAl = reinterpret_cast<GmmMaxMixActiveList>(kernel.Kernel);
+                        report(kernel, shape, operations, [&]() { gmmAl(&config, al); });
+                    }
+                    else
+                    {
+                        auto const gmm = reinterpret_cast<GmmMaxMix>(kernel.Kernel);
+                        report(kernel, shape, operations, [&]() { gmm(&config); });
+                    }
+                }
+            }
+        }
+    }
+
+    // Creates increasing PWL with segments evenly spread around zero,
+    // positive half covers range of benchmark inputs
+    static PwlCached createPwl(uint32_t segmentCount)
+    {
+        std::vector<nn_pwl_seg> segments(segmentCount);
+        auto const segmentWidth = static_cast<int32_t>(0x20000000 / segmentCount);
+        for (uint32_t i = 0; i < segmentCount; i++)
+        {
+            auto const position = static_cast<int32_t>(i) - static_cast<int32_t>(segmentCount / 2);
+            segments[i].xBase = (0 == i) ? INT32_MIN : position * segmentWidth;
+            segments[i].yBase = static_cast<int16_t>(position * 64);
+            segments[i].slope = 256;
+        }
+        return PwlCached{ GNA_INT16, segments.data(), segmentCount };
+    }
+
+    BenchOptions const options;
+
+    KernelBuffers buffers;
+
+    uint32_t saturationCount = 0;
+
+    ExecutionConfig const execution;
+
+    std::vector<Gna2AccelerationMode> const supportedAccelerations;
+};
+
+}
+
+int main(int argc, char * argv[])
+{
+    BenchOptions options;
+    for (int i = 1; i < argc; i++)
+    {
+        if (0 == strcmp(argv[i], "--filter") && i + 1 < argc)
+        {
+            options.Filter = argv[++i];
+        }
+        else if (0 == strcmp(argv[i], "--time") && i + 1 < argc)
+        {
+            options.MinimumTimeMs = static_cast<uint32_t>(strtoul(argv[++i], nullptr, 10));
+        }
+        else
+        {
+            printf("Usage: %s [--filter <operation name part>] [--time <minimum ms per measurement>]\n", argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    try
+    {
+        Bench{ options }.Run();
+    }
+    catch (std::exception const & e)
+    {
+        printf("Benchmark failed: %s\n", e.what());
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
@@ -114,6 +114,7 @@ typedef enum _kernel_op
     KERNEL_PWL,
     KERNEL_AFFINE_AL,
     KERNEL_GMM_AL,
+    KERNEL_AFFINE_PACKED,
 
 } kernel_op;
 
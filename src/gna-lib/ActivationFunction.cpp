@@ -10,6 +10,7 @@
 #include "Capabilities.h"
 #include "ConvolutionalLayer2DCapabilities.h"
 #include "GnaException.h"
+#include "LayerCapabilities.h"
 #include "ModelError.h"
 #include "ParameterLimits.h"
 #include "Shape.h"
@@ -68,6 +69,13 @@ static const ShapeLimits _InterleaveLimits =
     {GNA_DIM_W, {1, XNN_N_GROUP_MAX, 1, Gna2StatusXnnErrorOutputVolume}}
 };
 
+// Fully connected affine batches exceeding hardware grouping are tiled by software
+static const ShapeLimits _TiledInterleaveLimits =
+{
+    {GNA_DIM_H, {1, XNN_N_IN_ELEMS_MAX, 1, Gna2StatusXnnErrorOutputVolume}},
+    {GNA_DIM_W, {1, LayerCapabilities::SoftwareInputGroupsCountMax, 1, Gna2StatusXnnErrorOutputVolume}}
+};
+
 static const DataModeLimits _ModesGen0_9 =
 {
     {GNA_INT16, GNA_DATA_ACTIVATION_DISABLED},
@@ -81,6 +89,13 @@ static const TensorLimits _InterleaveTensorLimitsGen0_9 =
     _ModesGen0_9
 };
 
+static const TensorLimits _TiledInterleaveTensorLimitsGen0_9 =
+{
+    {GNA_TENSOR_HW},
+    _TiledInterleaveLimits,
+    _ModesGen0_9
+};
+
 static const TensorLimits _FlatTensorLimitsGen0_9 =
 {
     {GNA_TENSOR_HW},
@@ -101,6 +116,13 @@ static const TensorLimits _InterleaveTensorLimitsGen3 =
     _ModesGen3
 };
 
+static const TensorLimits _TiledInterleaveTensorLimitsGen3 =
+{
+    {GNA_TENSOR_HW},
+    _TiledInterleaveLimits,
+    _ModesGen3
+};
+
 static const TensorLimits _FlatTensorLimitsGen3 =
 {
     {GNA_TENSOR_HW},
@@ -111,8 +133,8 @@ static const TensorLimits _FlatTensorLimitsGen3 =
 const FullCapabilitiesMap ActivationFunction::outputCapabilities =
 {
     {INTEL_AFFINE, {
-        {GNA_0_9, std::make_shared<TensorLimits>(_InterleaveTensorLimitsGen0_9)},
-        {GNA_3_0, std::make_shared<TensorLimits>(_InterleaveTensorLimitsGen3)}
+        {GNA_0_9, std::make_shared<TensorLimits>(_TiledInterleaveTensorLimitsGen0_9)},
+        {GNA_3_0, std::make_shared<TensorLimits>(_TiledInterleaveTensorLimitsGen3)}
     }},
     {INTEL_AFFINE_DIAGONAL, {
         {GNA_0_9, std::make_shared<TensorLimits>(_InterleaveTensorLimitsGen0_9)},
@@ -198,6 +220,27 @@ void ActivationFunction::UpdateActiveOutputCount(
     config->Transform.ElementCount = outputCount;
 }
 
+void ActivationFunction::ComputePart(AccelerationMode accel, LayerConfiguration const * layerConfiguration,
+    ExecutionConfig const & execution, uint32_t firstElement, uint32_t elementCount,
+    int8_t const * input, int8_t * output) const
+{
+    auto const executionConfig = createExecutionConfig(layerConfiguration, execution);
+    auto partConfig = KernelConfig<ActivationConfig>{ *executionConfig.RequestConfig };
+    partConfig.Transform.ElementCount = elementCount;
+    partConfig.Inputs = (nullptr != input) ? input
+        : partConfig.Inputs + uint64_t{ firstElement } * sizeof(int32_t);
+    partConfig.Outputs = (nullptr != output) ? output
+        : partConfig.Outputs + uint64_t{ firstElement } * Pwl.pwl.bytesPerOutput;
+    auto const partExecution = ExecutionKernelConfig<ActivationConfig>{ &partConfig, execution };
+    try
+    {
+        kernels.at(accel)(&partExecution);
+    }
+    catch (const std::out_of_range&)
+    {
+        throw GnaException(Gna2StatusNotImplemented);
+    }
+}
 
 PwlCached ActivationFunction::createPwlCached(const gna_data_mode mode,
     nn_pwl_seg const * const segmentsIn, uint32_t segmentCountIn)
@@ -31,6 +31,13 @@ public:
     void UpdateActiveOutputCount(std::unique_ptr<BaseConfig> configs[TransformOperationCount],
         uint32_t outputCount) const;
 
+    // Activates elementCount outputs starting from firstElement,
+    // used by transforms activating their outputs in blocks,
+    // non-null input or output replaces configured buffer offset by firstElement
+    void ComputePart(AccelerationMode accel, LayerConfiguration const * layerConfiguration,
+        ExecutionConfig const & execution, uint32_t firstElement, uint32_t elementCount,
+        int8_t const * input = nullptr, int8_t * output = nullptr) const;
+
     ActivationFunction(const BaseTransformConfig<ActivationKernel>& config,
         DataMode mode, std::unique_ptr<Tensor> pwl);
     ActivationFunction() = delete;
@@ -6,6 +6,7 @@
 #include "AffineFunctions.h"
 
 #include "AccelerationDetector.h"
+#include "ActivationFunction.h"
 #include "ActiveList.h"
 #include "AffineLayerCapabilities.h"
 #include "Bias.h"
@@ -13,9 +14,11 @@
 #include "DataMode.h"
 #include "Expect.h"
 #include "GnaException.h"
+#include "Layer.h"
 #include "LayerConfiguration.h"
 #include "OperationConfig.h"
 #include "Shape.h"
+#include "ThreadPool.h"
 #include "Validator.h"
 #include "Weight.h"
 
@@ -27,7 +30,9 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <cstring>
 #include <memory>
+#include <vector>
 
 using namespace GNA;
 
@@ -171,6 +176,78 @@ AffineFunctionSingle::AffineFunctionSingle(
             BaseConfig { Input->Buffer, Output->Buffer });
 }
 
+AffineFunctionSingle::~AffineFunctionSingle()
+{
+    if (nullptr != packedBuffer)
+    {
+        _gna_free(packedBuffer);
+    }
+}
+
+void AffineFunctionSingle::PackWeights()
+{
+    using Layout = AffinePackedLayout;
+
+    if (AffineTransform != Operation || nullptr != packedBuffer
+        || Gna2DataTypeInt16 != Input->Mode.Type || Gna2DataTypeInt16 != Weights->Mode.Type
+        || Gna2TensorModeConstantScalar == Biases->Mode.Mode || Gna2DataTypeCompoundBias == Biases->Mode.Type)
+    {
+        return;
+    }
+
+    auto const & transform = hiddenConfig->Transform;
+    auto const rowCount = transform.outputElementCount;
+    auto const elementCount = transform.inputElementCount;
+    auto const panelCount = (rowCount + Layout::RowCount - 1) / Layout::RowCount;
+    auto const paddedElementCount = Layout::GetChunkCount(elementCount) * Layout::ElementCount;
+    auto const weightsSize = uint64_t{ panelCount } * Layout::RowCount * Layout::GetRowSize(elementCount);
+    auto const biasesSize = uint64_t{ panelCount } * Layout::RowCount * sizeof(int32_t);
+    auto * const buffer = static_cast<int8_t *>(_kernel_malloc(weightsSize + biasesSize));
+    Expect::ValidBuffer(buffer);
+    memset(buffer, 0, weightsSize + biasesSize);
+
+    // each panel holds consecutive chunks of all its rows
+    auto * const weights = reinterpret_cast<int16_t *>(buffer);
+    for (uint32_t row = 0; row < rowCount; row++)
+    {
+        auto * const panel = weights + uint64_t{ row / Layout::RowCount } * Layout::RowCount * paddedElementCount
+            + (row % Layout::RowCount) * Layout::ElementCount;
+        auto const * const rowWeights = transform.weights2B + uint64_t{ row } * elementCount;
+        for (uint32_t k = 0; k < elementCount; k++)
+        {
+            panel[(k / Layout::ElementCount) * Layout::RowCount * Layout::ElementCount
+                + k % Layout::ElementCount] = rowWeights[k];
+        }
+    }
+    auto * const biases = reinterpret_cast<int32_t *>(buffer + weightsSize);
+    for (uint32_t row = 0; row < rowCount; row++)
+    {
+        biases[row] = getBias(transform.biasesSimple, transform.bytesPerBias, row);
+    }
+
+    packedKernels = std::make_unique<const KernelTable<AffineKernel>>(
+        AccelerationDetector::GetKernelMap<AffineKernel>(KERNEL_AFFINE_PACKED,
+            KernelMode{ Input->Mode, Weights->Mode, Biases->Mode }));
+    packedBuffer = buffer;
+    packedBiases = buffer + weightsSize;
+}
+
+AffineFunctionSingle::RowWeights AffineFunctionSingle::getRowWeights(AccelerationMode const & accel,
+    AffineConfig const & transform) const
+{
+    if (packedKernels && packedKernels->Has(accel))
+    {
+        return RowWeights{ packedKernels->at(accel), packedBuffer, packedBiases,
+            AffinePackedLayout::GetRowSize(transform.inputElementCount),
+            static_cast<uint32_t>(sizeof(int32_t)), true };
+    }
+    return RowWeights{ kernels.at(accel),
+        static_cast<int8_t const *>(static_cast<void const *>(transform.weights1B)),
+        static_cast<int8_t const *>(static_cast<void const *>(transform.biasesCompound)),
+        uint64_t{ transform.inputElementCount } * Weights->Mode.Size,
+        Gna2TensorModeConstantScalar == Biases->Mode.Mode ? 0 : transform.bytesPerBias, false };
+}
+
 void AffineFunctionSingle::ValidateActiveList(ActiveList const& activeList) const
 {
     Expect::InRange(activeList.IndicesCount,
@@ -189,19 +266,361 @@ void AffineFunctionSingle::Compute(AccelerationMode accel,
     {
         if (layerConfiguration != nullptr && layerConfiguration->ActList)
         {
-            kernelsAl.at(accel)(executionConfig.get(), AffineConfigAl{
+            kernelsAl.at(accel)(&executionConfig, AffineConfigAl{
                                 layerConfiguration->ActList->Indices,
                                 layerConfiguration->ActList->IndicesCount});
         }
+        else if (execution.Workers != nullptr && AffineTransform == Operation)
+        {
+            computeParallel(getRowWeights(accel, executionConfig.RequestConfig->Transform),
+                executionConfig, nullptr);
+        }
+        else if (AffineTransform == Operation)
+        {
+            computeRows(getRowWeights(accel, executionConfig.RequestConfig->Transform),
+                *executionConfig.RequestConfig, execution,
+                0, executionConfig.RequestConfig->Transform.outputElementCount, nullptr);
+        }
+        else
+        {
+            kernels.at(accel)(&executionConfig);
+        }
+    }
+    catch (const std::out_of_range&)
+    {
+        throw GnaException(Gna2StatusNotImplemented);
+    }
+}
+
+void AffineFunctionSingle::ComputeActivated(ActivationFunction const & activation, AccelerationMode accel,
+    LayerConfiguration const * layerConfiguration, ExecutionConfig const & execution) const
+{
+    // active list outputs are compacted, thus activated in separate pass
+    if (layerConfiguration != nullptr && layerConfiguration->ActList)
+    {
+        Compute(accel, layerConfiguration, execution);
+        activation.Compute(accel, layerConfiguration, execution);
+        return;
+    }
+
+    auto const executionConfig = createExecutionConfig(layerConfiguration, execution);
+    auto const rowActivation = RowActivation{ activation, accel, layerConfiguration };
+    try
+    {
+        auto const rowWeights = getRowWeights(accel, executionConfig.RequestConfig->Transform);
+        if (execution.Workers != nullptr)
+        {
+            computeParallel(rowWeights, executionConfig, &rowActivation);
+        }
         else
         {
-            kernels->at(accel)(executionConfig.get());
+            computeRows(rowWeights, *executionConfig.RequestConfig, execution,
+                0, executionConfig.RequestConfig->Transform.outputElementCount, &rowActivation);
+        }
+    }
+    catch (const std::out_of_range&)
+    {
+        throw GnaException(Gna2StatusNotImplemented);
+    }
+}
+
+// Stores rowCount elements of each of columnCount columns as interleaved rows
+template<typename T>
+static void interleave(int8_t const * const * columns, uint32_t columnCount, uint32_t rowCount, int8_t * output)
+{
+    auto * const out = reinterpret_cast<T *>(output);
+    for (uint32_t c = 0; c < columnCount; c++)
+    {
+        auto const * const in = reinterpret_cast<T const *>(columns[c]);
+        for (uint32_t r = 0; r < rowCount; r++)
+        {
+            out[r * columnCount + c] = in[r];
+        }
+    }
+}
+
+bool AffineFunctionSingle::ComputeActivatedBatch(ActivationFunction const & activation, AccelerationMode accel,
+    LayerBatch const & batch) const
+{
+    // 32-bit outputs of block of all requests stay in cache until activated, as in computeRows
+    static constexpr uint32_t blockOutputSize = 32 * 1024;
+    static constexpr uint32_t rowAlignment = 16;
+    static constexpr uint32_t inputsAlignment = 64;
+
+    // saturating kernels split sums into parts depending on vector count, thus results would differ
+    auto const count = batch.Count;
+    if (count < 2 || AffineTransform != Operation || accel.GetHwConsistency())
+    {
+        return false;
+    }
+
+    KernelConfig<AffineConfig> const * requestConfigs[XNN_N_GROUP_MAX];
+    int8_t const * requestInputs[XNN_N_GROUP_MAX];
+    for (uint32_t i = 0; i < count; i++)
+    {
+        auto const configuration = batch.Configurations[i];
+        if (nullptr != configuration && configuration->ActList)
+        {
+            return false;
+        }
+        requestConfigs[i] = createExecutionConfig(configuration, *batch.Executions[i]).RequestConfig;
+        requestInputs[i] = requestConfigs[i]->Inputs;
+        auto const & requestTransform = requestConfigs[i]->Transform;
+        if (1 != requestTransform.inputVectorCount
+            || requestTransform.weights1B != requestConfigs[0]->Transform.weights1B
+            || requestTransform.biasesCompound != requestConfigs[0]->Transform.biasesCompound)
+        {
+            return false;
+        }
+    }
+
+    auto const & transform = requestConfigs[0]->Transform;
+    auto const inputElementCount = transform.inputElementCount;
+    auto const blockRowCount = (std::max)(rowAlignment,
+        blockOutputSize / (count * static_cast<uint32_t>(sizeof(int32_t))) / rowAlignment * rowAlignment);
+    auto const inputsSize = RoundUp(inputElementCount * count * Input->Mode.Size, inputsAlignment);
+
+    auto & buffers = *batch.Executions[0]->Intermediate;
+    buffers.ReallocateBlockBuffer(inputsSize + (count + 1) * blockRowCount * static_cast<uint32_t>(sizeof(int32_t)));
+    auto * const inputs = buffers.blockBuffer;
+    auto * const outputs = reinterpret_cast<int32_t *>(inputs + inputsSize);
+    auto * const column = outputs + blockRowCount * count;
+    if (1 == Input->Mode.Size)
+    {
+        interleave<int8_t>(requestInputs, count, inputElementCount, inputs);
+    }
+    else
+    {
+        interleave<int16_t>(requestInputs, count, inputElementCount, inputs);
+    }
+
+    auto const rowCount = transform.outputElementCount;
+    try
+    {
+        auto const rowWeights = getRowWeights(accel, transform);
+        for (uint32_t row = 0; row < rowCount; row += blockRowCount)
+        {
+            auto const blockRows = (std::min)(blockRowCount, rowCount - row);
+            auto const blockConfig = AffineConfig{ blockRows, count, inputElementCount, nullptr, nullptr,
+                rowWeights.GetWeights(row), rowWeights.GetBiases(row),
+                transform.multiBias, transform.multiBiasVectorCount, transform.bytesPerBias };
+            auto blockRequestConfig = KernelConfig<AffineConfig>{ blockConfig, *requestConfigs[0] };
+            blockRequestConfig.Inputs = inputs;
+            blockRequestConfig.Outputs = reinterpret_cast<int8_t *>(outputs);
+            auto const blockExecution = ExecutionKernelConfig<AffineConfig>{ &blockRequestConfig, *batch.Executions[0] };
+            rowWeights.Kernel(&blockExecution);
+
+            // outputs of request are column of block, activated to request output
+            for (uint32_t i = 0; i < count; i++)
+            {
+                for (uint32_t r = 0; r < blockRows; r++)
+                {
+                    column[r] = outputs[r * count + i];
+                }
+                activation.ComputePart(accel, batch.Configurations[i], *batch.Executions[i], row, blockRows,
+                    reinterpret_cast<int8_t const *>(column));
+            }
         }
     }
     catch (const std::out_of_range&)
     {
         throw GnaException(Gna2StatusNotImplemented);
     }
+    return true;
+}
+
+void AffineFunctionSingle::computeParallel(RowWeights const & rowWeights,
+    ExecutionKernelConfig<AffineConfig> const & config, RowActivation const * activation) const
+{
+    // Minimal number of multiply-adds per part that outweighs thread synchronization
+    static constexpr uint64_t minPartWork = 64 * 1024;
+    // Parts are aligned to 16 rows so that parts do not share output cache lines
+    static constexpr uint32_t rowAlignment = 16;
+
+    auto const & transform = config.RequestConfig->Transform;
+    auto const rowCount = transform.outputElementCount;
+    auto const rowWork = uint64_t{ transform.inputElementCount } * transform.inputVectorCount;
+    auto const maxPartCount = static_cast<uint32_t>((std::min)(
+        uint64_t{ config.Workers->GetNumberOfThreads() }, rowCount * rowWork / minPartWork));
+    if (maxPartCount < 2)
+    {
+        computeRows(rowWeights, *config.RequestConfig, config, 0, rowCount, activation);
+        return;
+    }
+    auto const rowsPerPart = RoundUp((rowCount + maxPartCount - 1) / maxPartCount, rowAlignment);
+    auto const partCount = (rowCount + rowsPerPart - 1) / rowsPerPart;
+
+    // each part counts saturations separately to avoid data race
+    std::vector<uint32_t> saturationCounts(partCount, 0);
+
+    config.Workers->ParallelFor(partCount, config.Intermediate,
+        [&](uint32_t partIndex, KernelBuffers * buffers)
+    {
+        auto const firstRow = partIndex * rowsPerPart;
+        computeRows(rowWeights, *config.RequestConfig,
+            ExecutionConfig{ buffers, &saturationCounts.at(partIndex), config.BufferElementCount },
+            firstRow, (std::min)(rowsPerPart, rowCount - firstRow), activation);
+    });
+
+    for (auto const saturationCount : saturationCounts)
+    {
+        *config.SaturationCount += saturationCount;
+    }
+}
+
+void AffineFunctionSingle::computeRows(RowWeights const & rowWeights, KernelConfig<AffineConfig> & requestConfig,
+    ExecutionConfig const & execution, uint32_t firstRow, uint32_t rowCount,
+    RowActivation const * activation) const
+{
+    // 32-bit outputs of block stay in cache until activated,
+    // while input deinterleaving repeated by kernel for each block stays negligible
+    static constexpr uint32_t blockOutputSize = 32 * 1024;
+    // Blocks are multiple of 16 rows, as parallel parts
+    static constexpr uint32_t rowAlignment = 16;
+
+    auto const & transform = requestConfig.Transform;
+    auto const vectorCount = transform.inputVectorCount;
+    if (vectorCount > XNN_N_GROUP_MAX)
+    {
+        computeTiles(rowWeights, requestConfig, execution, firstRow, rowCount, activation);
+        return;
+    }
+    if (nullptr == activation && 0 == firstRow && transform.outputElementCount == rowCount && !rowWeights.IsPacked)
+    {
+        auto const executionConfig = ExecutionKernelConfig<AffineConfig>{ &requestConfig, execution };
+        rowWeights.Kernel(&executionConfig);
+        return;
+    }
+    auto const blockRowCount = nullptr == activation ? rowCount
+        : (std::max)(rowAlignment, blockOutputSize / (vectorCount * static_cast<uint32_t>(sizeof(int32_t)))
+            / rowAlignment * rowAlignment);
+
+    // with activation 32-bit outputs of block are kept in thread's own buffer instead of layer scratchpad
+    int8_t * blockOutputs = nullptr;
+    if (nullptr != activation)
+    {
+        auto & buffers = *execution.Intermediate;
+        buffers.ReallocateBlockBuffer(blockRowCount * vectorCount * static_cast<uint32_t>(sizeof(int32_t)));
+        blockOutputs = buffers.blockBuffer;
+    }
+
+    auto const rowEnd = firstRow + rowCount;
+    for (auto row = firstRow; row < rowEnd; row += blockRowCount)
+    {
+        auto const blockRows = (std::min)(blockRowCount, rowEnd - row);
+        auto const blockConfig = AffineConfig{ transform, row, blockRows,
+            rowWeights.GetWeights(row), rowWeights.GetBiases(row) };
+        auto blockRequestConfig = KernelConfig<AffineConfig>{ blockConfig, requestConfig };
+        blockRequestConfig.Outputs = nullptr != blockOutputs ? blockOutputs
+            : requestConfig.Outputs + uint64_t{ row } * vectorCount * sizeof(int32_t);
+        auto const blockExecution = ExecutionKernelConfig<AffineConfig>{ &blockRequestConfig, execution };
+        rowWeights.Kernel(&blockExecution);
+        if (nullptr != activation)
+        {
+            activation->Function.ComputePart(activation->Accel, activation->Configuration, execution,
+                row * vectorCount, blockRows * vectorCount, blockOutputs);
+        }
+    }
+}
+
+// Gathers columnCount columns starting from firstColumn of rowCount rows of vectorCount interleaved columns
+template<typename T>
+static void gatherColumns(int8_t const * input, uint32_t vectorCount, uint32_t rowCount,
+    uint32_t firstColumn, uint32_t columnCount, int8_t * output)
+{
+    auto const * const in = reinterpret_cast<T const *>(input) + firstColumn;
+    auto * const out = reinterpret_cast<T *>(output);
+    for (uint32_t r = 0; r < rowCount; r++)
+    {
+        for (uint32_t c = 0; c < columnCount; c++)
+        {
+            out[r * columnCount + c] = in[uint64_t{ r } * vectorCount + c];
+        }
+    }
+}
+
+void AffineFunctionSingle::computeTiles(RowWeights const & rowWeights, KernelConfig<AffineConfig> const & requestConfig,
+    ExecutionConfig const & execution, uint32_t firstRow, uint32_t rowCount,
+    RowActivation const * activation) const
+{
+    // Weights of block are reused by all tiles while in L2 cache,
+    // as are 32-bit outputs of block until activated,
+    // large enough to amortize input deinterleaving repeated by kernel for each tile
+    static constexpr uint32_t blockWeightsSize = 512 * 1024;
+    static constexpr uint32_t blockOutputSize = 512 * 1024;
+    // Blocks are multiple of 16 rows, as parallel parts
+    static constexpr uint32_t rowAlignment = 16;
+    static constexpr uint32_t tileAlignment = 64;
+
+    auto const & transform = requestConfig.Transform;
+    auto const vectorCount = transform.inputVectorCount;
+    auto const inputElementCount = transform.inputElementCount;
+    auto const tileCount = (vectorCount + XNN_N_GROUP_MAX - 1) / XNN_N_GROUP_MAX;
+    auto const blockRowCount = RoundUp((std::max)(ui32_1,
+        (std::min)(blockWeightsSize / (inputElementCount * Weights->Mode.Size),
+            blockOutputSize / (vectorCount * static_cast<uint32_t>(sizeof(int32_t))))), rowAlignment);
+    auto const tileInputSize = RoundUp(inputElementCount * XNN_N_GROUP_MAX * Input->Mode.Size, tileAlignment);
+    auto const tileOutputSize = RoundUp(blockRowCount * XNN_N_GROUP_MAX * static_cast<uint32_t>(sizeof(int32_t)),
+        tileAlignment);
+    auto const blockOutputsSize = nullptr == activation ? 0
+        : blockRowCount * vectorCount * static_cast<uint32_t>(sizeof(int32_t));
+
+    // inputs are gathered once into tiles of at most XNN_N_GROUP_MAX vectors, as kernels support
+    auto & buffers = *execution.Intermediate;
+    buffers.ReallocateBlockBuffer(tileCount * tileInputSize + tileOutputSize + blockOutputsSize);
+    auto * const tileInputs = buffers.blockBuffer;
+    auto * const tileOutputs = reinterpret_cast<int32_t *>(tileInputs + tileCount * tileInputSize);
+    auto * const blockOutputs = tileOutputs + tileOutputSize / sizeof(int32_t);
+    for (uint32_t tile = 0; tile < tileCount; tile++)
+    {
+        auto const firstColumn = tile * XNN_N_GROUP_MAX;
+        auto const columnCount = (std::min)(XNN_N_GROUP_MAX, vectorCount - firstColumn);
+        if (1 == Input->Mode.Size)
+        {
+            gatherColumns<int8_t>(requestConfig.Inputs, vectorCount, inputElementCount,
+                firstColumn, columnCount, tileInputs + tile * tileInputSize);
+        }
+        else
+        {
+            gatherColumns<int16_t>(requestConfig.Inputs, vectorCount, inputElementCount,
+                firstColumn, columnCount, tileInputs + tile * tileInputSize);
+        }
+    }
+
+    auto * const outputs = reinterpret_cast<int32_t *>(requestConfig.Outputs);
+    auto const rowEnd = firstRow + rowCount;
+    for (auto row = firstRow; row < rowEnd; row += blockRowCount)
+    {
+        auto const blockRows = (std::min)(blockRowCount, rowEnd - row);
+        // without activation tiles are scattered directly to outputs
+        auto * const blockColumns = nullptr == activation ? outputs + uint64_t{ row } * vectorCount : blockOutputs;
+        for (uint32_t tile = 0; tile < tileCount; tile++)
+        {
+            auto const firstColumn = tile * XNN_N_GROUP_MAX;
+            auto const columnCount = (std::min)(XNN_N_GROUP_MAX, vectorCount - firstColumn);
+            auto const tileConfig = AffineConfig{ blockRows, columnCount, inputElementCount, nullptr, nullptr,
+                rowWeights.GetWeights(row), rowWeights.GetBiases(row),
+                transform.multiBias, transform.multiBiasVectorCount, transform.bytesPerBias };
+            auto tileRequestConfig = KernelConfig<AffineConfig>{ tileConfig, requestConfig };
+            tileRequestConfig.Inputs = tileInputs + tile * tileInputSize;
+            tileRequestConfig.Outputs = reinterpret_cast<int8_t *>(tileOutputs);
+            auto const tileExecution = ExecutionKernelConfig<AffineConfig>{ &tileRequestConfig, execution };
+            rowWeights.Kernel(&tileExecution);
+
+            for (uint32_t r = 0; r < blockRows; r++)
+            {
+                for (uint32_t c = 0; c < columnCount; c++)
+                {
+                    blockColumns[r * vectorCount + firstColumn + c] = tileOutputs[r * columnCount + c];
+                }
+            }
+        }
+        if (nullptr != activation)
+        {
+            activation->Function.ComputePart(activation->Accel, activation->Configuration, execution,
+                row * vectorCount, blockRows * vectorCount, reinterpret_cast<int8_t const *>(blockOutputs));
+        }
+    }
 }
 
 AffineFunctionMulti::AffineFunctionMulti(BaseTransformConfig<AffineKernel> config,
@@ -22,10 +22,12 @@
 
 namespace GNA
 {
+class ActivationFunction;
 class FullCapabilitiesMap;
 class LayerValidator;
 class OperationConfig;
 
+struct LayerBatch;
 struct LayerConfiguration;
 
 // AffineFunction interface
@@ -77,17 +79,86 @@ public:
         std::unique_ptr<const WeightTensor> weights,
         std::unique_ptr<const BiasTensor> biases);
 
-    virtual ~AffineFunctionSingle() = default;
+    virtual ~AffineFunctionSingle();
 
     void ValidateActiveList(ActiveList const & activeList) const override;
 
     void Compute(AccelerationMode accel, LayerConfiguration const* layerConfiguration,
                  ExecutionConfig const& execution) const override;
 
+    // Computes outputs in blocks of rows and activates each block right after it is computed,
+    // while its 32-bit outputs are still in cache
+    void ComputeActivated(ActivationFunction const & activation, AccelerationMode accel,
+        LayerConfiguration const * layerConfiguration, ExecutionConfig const & execution) const;
+
+    // Computes activated outputs of batch requests at once, as columns of single multi-vector input,
+    // returns false when requests do not share weights and biases or use active lists
+    bool ComputeActivatedBatch(ActivationFunction const & activation, AccelerationMode accel,
+        LayerBatch const & batch) const;
+
+    // Copies 2B weights and biases of fully connected layer into AffinePackedLayout
+    // used instead of model weights by fast kernels that support it,
+    // thus later changes of model weights are not observed
+    void PackWeights();
+
 private:
+    // Activation applied to blocks of rows by fused computation
+    struct RowActivation
+    {
+        ActivationFunction const & Function;
+        AccelerationMode const & Accel;
+        LayerConfiguration const * const Configuration;
+    };
+
+    // Kernel with weights and biases it computes rows from, packed when packed kernel supports acceleration
+    struct RowWeights
+    {
+        AffineKernel Kernel;
+        int8_t const * Weights;
+        int8_t const * Biases;
+        uint64_t WeightsRowSize;
+        uint32_t BiasSize;
+        bool IsPacked;
+
+        int8_t const * GetWeights(uint32_t row) const
+        {
+            return Weights + row * WeightsRowSize;
+        }
+
+        int8_t const * GetBiases(uint32_t row) const
+        {
+            return nullptr == Biases ? nullptr : Biases + row * BiasSize;
+        }
+    };
+
+    RowWeights getRowWeights(AccelerationMode const & accel, AffineConfig const & transform) const;
+
+    // Splits output rows between execution.Workers threads when layer is large enough
+    void computeParallel(RowWeights const & rowWeights, ExecutionKernelConfig<AffineConfig> const & config,
+        RowActivation const * activation) const;
+
+    // Computes rowCount outputs starting from firstRow,
+    // followed by activation of every cache sized block of rows when activation is not NULL
+    void computeRows(RowWeights const & rowWeights, KernelConfig<AffineConfig> & requestConfig,
+        ExecutionConfig const & execution, uint32_t firstRow, uint32_t rowCount,
+        RowActivation const * activation) const;
+
+    // Computes rows as computeRows for more than XNN_N_GROUP_MAX vectors,
+    // split into tiles of XNN_N_GROUP_MAX vectors sharing each cache sized block of weights
+    void computeTiles(RowWeights const & rowWeights, KernelConfig<AffineConfig> const & requestConfig,
+        ExecutionConfig const & execution, uint32_t firstRow, uint32_t rowCount,
+        RowActivation const * activation) const;
+
     static const FullCapabilitiesMap outputCapabilities;
 
-    const KernelMap<AffineActiveListKernel>& kernelsAl;
+    const KernelTable<AffineActiveListKernel> kernelsAl;
+
+    std::unique_ptr<const KernelTable<AffineKernel>> packedKernels;
+
+    // Packed weights followed by 32-bit biases, allocated by PackWeights
+    int8_t * packedBuffer = nullptr;
+
+    int8_t const * packedBiases = nullptr;
 };
 
 class AffineFunctionMulti : public AffineFunction
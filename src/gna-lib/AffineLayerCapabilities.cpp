@@ -195,6 +195,42 @@ const std::shared_ptr<ComponentLimits>& AffineLayerCapabilities::GetOutputCompon
     return operands.at(generation);
 }
 
+const std::shared_ptr<ComponentLimits>& AffineLayerCapabilities::GetTiledInputComponentLimits(const gna_device_generation generation)
+{
+    static const OperationCapabilityMap operands =
+    {
+        {GNA_0_9, std::make_shared<TensorLimits>(TensorLimits{
+            {GNA_TENSOR_HW},
+            {{GNA_DIM_H, limitsForInputShapeLegacy()},
+            {GNA_DIM_W, limitsForInputGroupsSoftwareMax()}},
+            GetModes(InputOperandIndex, GNA_0_9)})},
+        {GNA_3_0, std::make_shared<TensorLimits>(TensorLimits{
+            {GNA_TENSOR_HW},
+            {{GNA_DIM_H, limitsForInputShapeLegacy()},
+            {GNA_DIM_W, limitsForInputGroupsSoftwareMax()}},
+            GetModes(InputOperandIndex, GNA_3_0)})},
+    };
+    return operands.at(generation);
+}
+
+const std::shared_ptr<ComponentLimits>& AffineLayerCapabilities::GetTiledOutputComponentLimits(const gna_device_generation generation)
+{
+    static const OperationCapabilityMap operands =
+    {
+        {GNA_0_9, std::make_shared<TensorLimits>(TensorLimits{
+            {GNA_TENSOR_HW},
+            {{GNA_DIM_H, limitsForOutput()},
+            {GNA_DIM_W, limitsForOutputGroupsSoftwareMax()}},
+            GetModes(OutputOperandIndex, GNA_0_9)})},
+        {GNA_3_0, std::make_shared<TensorLimits>(TensorLimits{
+            {GNA_TENSOR_HW},
+            {{GNA_DIM_H, limitsForOutput()},
+            {GNA_DIM_W, limitsForOutputGroupsSoftwareMax()}},
+            GetModes(OutputOperandIndex, GNA_3_0)})},
+    };
+    return operands.at(generation);
+}
+
 const std::shared_ptr<ComponentLimits>& AffineLayerCapabilities::GetMBOutputComponentLimits(const gna_device_generation generation)
 {
     auto multiBiasLimits = GetOutputComponentLimits(GNA_2_0);
@@ -212,8 +248,8 @@ const FullCapabilitiesMap& AffineLayerCapabilities::GetOperands(uint32_t operand
     {
         {InputOperandIndex,{
             {INTEL_AFFINE, {
-                {GNA_0_9, GetInputComponentLimits(GNA_0_9)},
-                {GNA_3_0, GetInputComponentLimits(GNA_3_0)},
+                {GNA_0_9, GetTiledInputComponentLimits(GNA_0_9)},
+                {GNA_3_0, GetTiledInputComponentLimits(GNA_3_0)},
             }},
             {INTEL_AFFINE_DIAGONAL, {
                 {GNA_0_9, GetInputComponentLimits(GNA_0_9)},
@@ -238,8 +274,8 @@ const FullCapabilitiesMap& AffineLayerCapabilities::GetOperands(uint32_t operand
         }},
         {OutputOperandIndex,{
             {INTEL_AFFINE, {
-                {GNA_0_9, GetOutputComponentLimits(GNA_0_9)},
-                {GNA_3_0, GetOutputComponentLimits(GNA_3_0)},
+                {GNA_0_9, GetTiledOutputComponentLimits(GNA_0_9)},
+                {GNA_3_0, GetTiledOutputComponentLimits(GNA_3_0)},
             }},
             {INTEL_AFFINE_DIAGONAL, {
                 {GNA_0_9, GetOutputComponentLimits(GNA_0_9)},
@@ -22,6 +22,13 @@ namespace GNA
          */
         static const std::shared_ptr<ComponentLimits>& GetMBOutputComponentLimits(const gna_device_generation generation);
 
+        /**
+         Fully connected Affine Input and Output Limits,
+         batches exceeding hardware grouping are tiled by software
+         */
+        static const std::shared_ptr<ComponentLimits>& GetTiledInputComponentLimits(const gna_device_generation generation);
+        static const std::shared_ptr<ComponentLimits>& GetTiledOutputComponentLimits(const gna_device_generation generation);
+
     };
 
 }
\ No newline at end of file
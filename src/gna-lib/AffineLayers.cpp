@@ -8,6 +8,7 @@
 #include "ActivationHelper.h"
 #include "ActiveList.h"
 #include "Address.h"
+#include "Expect.h"
 #include "KernelArguments.h"
 #include "LayerConfiguration.h"
 #include "LayerOutput.h"
@@ -61,6 +62,11 @@ DataConfig AffineBaseLayer::GetDataMode() const
 
 void AffineLayer::UpdateKernelConfigs(LayerConfiguration& layerConfiguration) const
 {
+    if (layerConfiguration.ActList)
+    {
+        // active list kernels are not tiled
+        Expect::InRange(Output.Dimensions.at('W'), ui32_1, XNN_N_GROUP_MAX, Gna2StatusXnnErrorGrouping);
+    }
     AffineBaseLayer::UpdateKernelConfigs(layerConfiguration);
     auto activation = Transforms.Get<ActivationFunction>(ActivationTransform);
     if (activation)
@@ -74,7 +80,9 @@ void AffineLayer::UpdateKernelConfigs(LayerConfiguration& layerConfiguration) co
 
 AffineLayer::AffineLayer(const nn_layer& layer, const BaseValidator& validatorIn) :
     AffineBaseLayer(layer, { AffineTransform, ActivationTransform }, validatorIn)
-{}
+{
+    initActivatedCompute();
+}
 
 AffineLayer::AffineLayer(const Gna2Operation& operation, const BaseValidator& validatorIn) :
     AffineBaseLayer(operation, { AffineTransform, ActivationTransform }, validatorIn)
@@ -84,6 +92,25 @@ AffineLayer::AffineLayer(const Gna2Operation& operation, const BaseValidator& va
         ModelErrorHelper::ExpectEqual(Output.AsModelValue('H'), Input.AsModelValue('H'));
         ModelErrorHelper::ExpectEqual(Output.AsModelValue('W'), Input.AsModelValue('W'));
     }
+    initActivatedCompute();
+}
+
+void AffineLayer::initActivatedCompute()
+{
+    // diagonal and multibias affine transforms are activated in separate pass
+    auto const affine = Transforms.Get<AffineFunctionSingle>(AffineTransform);
+    auto const activation = Transforms.Get<ActivationFunction>(ActivationTransform);
+    if (nullptr == affine || nullptr == activation)
+    {
+        return;
+    }
+    setComputeFunctions([affine, activation](AccelerationMode accel, ExecutionConfig const & executionConfig)
+    {affine->ComputeActivated(*activation, accel, nullptr, executionConfig); },
+        [affine, activation](LayerConfiguration &layerConfiguration, AccelerationMode accel,
+            ExecutionConfig const & executionConfig)
+    {affine->ComputeActivated(*activation, accel, &layerConfiguration, executionConfig); });
+    ComputeBatch = [affine, activation](LayerBatch const & batch, AccelerationMode accel)
+    {return affine->ComputeActivatedBatch(*activation, accel, batch); };
 }
 
 Tensor const & AffineBaseLayer::GetOperand(uint32_t operandIndex) const
@@ -55,6 +55,10 @@ public:
     virtual ~AffineLayer() = default;
 
     virtual void UpdateKernelConfigs(LayerConfiguration& layerConfiguration) const override;
+
+private:
+    // Replaces separate affine and activation passes with fused computation when possible
+    void initActivatedCompute();
 };
 
 }
@@ -10,6 +10,7 @@
 #include "GnaException.h"
 #include "HardwareCapabilities.h"
 #include "Layer.h"
+#include "LayerCapabilities.h"
 #include "Logger.h"
 #include "Macros.h"
 #include "Memory.h"
@@ -100,10 +101,11 @@ CompiledModel::AccelerationType CompiledModel::getEffectiveAccelerationMode(Requ
     return Auto;
 }
 
-Gna2Status CompiledModel::Score(
+void CompiledModel::Score(
     RequestConfiguration& config,
     RequestProfiler *profiler,
-    KernelBuffers *buffers)
+    KernelBuffers *buffers,
+    HardwareModelScorable::ScoreCompletion const & onCompleted)
 {
     auto saturationCount = uint32_t{ 0 };
     try
@@ -116,24 +118,89 @@ Gna2Status CompiledModel::Score(
             saturationCount = softwareModel.Score(0, LayerCount, config, profiler, buffers);
             break;
         case Auto:
-            saturationCount = scoreAllSubModels(config, profiler, buffers);
+            if (scoreAllSubModels(config, profiler, buffers, saturationCount, onCompleted))
+            {
+                return;
+            }
             break;
         default:
-            return Gna2StatusAccelerationModeNotSupported;
-            break;
+            onCompleted(Gna2StatusAccelerationModeNotSupported);
+            return;
         }
         profiler->Measure(Gna2InstrumentationPointLibCompletion);
     }
     catch (const GnaException& e)
     {
-        return e.GetStatus();
+        onCompleted(e.GetStatus());
+        return;
     }
     catch (...)
     {
         Log->Error("Unknown Exception in CompiledModel::Score()\n");
-        return Gna2StatusUnknownError;
+        onCompleted(Gna2StatusUnknownError);
+        return;
     }
-    return (saturationCount > 0) ? Gna2StatusWarningArithmeticSaturation : Gna2StatusSuccess;
+    onCompleted((saturationCount > 0) ? Gna2StatusWarningArithmeticSaturation : Gna2StatusSuccess);
+}
+
+void CompiledModel::ScoreBatch(
+    RequestConfiguration * const * configs,
+    RequestProfiler * const * profilers,
+    uint32_t count,
+    KernelBuffers *buffers,
+    BatchCompletion const & onCompleted)
+{
+    uint32_t saturationCounts[XNN_N_GROUP_MAX] = {};
+    try
+    {
+        for (uint32_t i = 0; i < count; i++)
+        {
+            profilers[i]->Measure(Gna2InstrumentationPointLibProcessing);
+        }
+        softwareModel.ScoreBatch(configs, profilers, count, buffers, saturationCounts);
+        for (uint32_t i = 0; i < count; i++)
+        {
+            profilers[i]->Measure(Gna2InstrumentationPointLibCompletion);
+        }
+    }
+    catch (const GnaException& e)
+    {
+        for (uint32_t i = 0; i < count; i++)
+        {
+            onCompleted(i, e.GetStatus());
+        }
+        return;
+    }
+    catch (...)
+    {
+        Log->Error("Unknown Exception in CompiledModel::ScoreBatch()\n");
+        for (uint32_t i = 0; i < count; i++)
+        {
+            onCompleted(i, Gna2StatusUnknownError);
+        }
+        return;
+    }
+    for (uint32_t i = 0; i < count; i++)
+    {
+        onCompleted(i, (saturationCounts[i] > 0) ? Gna2StatusWarningArithmeticSaturation : Gna2StatusSuccess);
+    }
+}
+
+bool CompiledModel::IsBatchable(RequestConfiguration & config)
+{
+    // consistency kernels saturate partial sums, thus results would depend on batch size
+    return EnforcedSoftware == getEffectiveAccelerationMode(config)
+        && !config.HasConsistencyMode()
+        && nullptr == config.ParallelWorkers;
+}
+
+bool CompiledModel::CanScoreInBatch(RequestConfiguration const & config,
+    RequestConfiguration const & other) const
+{
+    // layers of batch are computed in lockstep, thus requests must not access buffers written by others
+    return &config.Model == this && &other.Model == this
+        && config.Acceleration.GetMode() == other.Acceleration.GetMode()
+        && config.IsIndependentOf(other);
 }
 
 void CompiledModel::ValidateBuffer(MemoryContainer const & requestAllocations, Memory const & memory) const
@@ -145,22 +212,9 @@ void CompiledModel::ValidateBuffer(MemoryContainer const & requestAllocations, M
 }
 Memory const & CompiledModel::getMemoryFromDeviceAllocations(const void *buffer, size_t bufferSize) const
 {
-    const auto& allAllocations = DeviceManager::Get().GetAllAllocated();
-
-    for (auto const & memory : allAllocations)
-    {
-        Expect::NotNull(memory.get(), Gna2StatusXnnErrorInvalidBuffer);
-
-        auto const memoryBuffer = memory->GetBuffer();
-        Expect::NotNull(memoryBuffer, Gna2StatusXnnErrorInvalidBuffer);
-
-        auto const memorySize = memory->GetSize();
-        if (Expect::InMemoryRange(buffer, bufferSize, memoryBuffer, memorySize))
-        {
-            return *memory;
-        }
-    }
-    throw GnaException(Gna2StatusXnnErrorInvalidBuffer);
+    auto const memory = DeviceManager::Get().FindMemory(buffer, bufferSize);
+    Expect::NotNull(memory, Gna2StatusXnnErrorInvalidBuffer);
+    return *memory;
 }
 
 Memory const * CompiledModel::GetMemoryIfNotPartOfModel(const void *buffer, size_t bufferSize) const
@@ -204,11 +258,11 @@ BaseValidator CompiledModel::makeValidator()
     };
 }
 
-uint32_t CompiledModel::scoreAllSubModels(RequestConfiguration& config,
-    RequestProfiler *profiler, KernelBuffers *buffers)
+bool CompiledModel::scoreAllSubModels(RequestConfiguration& config,
+    RequestProfiler *profiler, KernelBuffers *buffers, uint32_t & saturationCount,
+    HardwareModelScorable::ScoreCompletion const & onCompleted)
 {
     const auto& deviceSubmodels = getSubmodels(hwCapabilities);
-    auto saturationCount = uint32_t{ 0 };
     for (const auto& submodel : deviceSubmodels)
     {
         uint32_t layerIndex = submodel->LayerIndex;
@@ -220,11 +274,30 @@ uint32_t CompiledModel::scoreAllSubModels(RequestConfiguration& config,
             break;
         case Hardware:
         case GMMHardware:
+            if (submodel == deviceSubmodels.back())
+            {
+                // worker thread is released while device processes last sub-model
+                auto const previousSaturationCount = saturationCount;
+                hardwareModel->ScoreAsync(layerIndex, layerCount, config, profiler,
+                    [profiler, previousSaturationCount, onCompleted](Gna2Status status)
+                    {
+                        if (Gna2StatusSuccess == status || Gna2StatusWarningArithmeticSaturation == status)
+                        {
+                            profiler->Measure(Gna2InstrumentationPointLibCompletion);
+                            if (previousSaturationCount > 0)
+                            {
+                                status = Gna2StatusWarningArithmeticSaturation;
+                            }
+                        }
+                        onCompleted(status);
+                    });
+                return true;
+            }
             saturationCount += hardwareModel->Score(layerIndex, layerCount, config, profiler, buffers);
             break;
         }
     }
-    return saturationCount;
+    return false;
 }
 
 const std::vector<std::unique_ptr<SubModel>>&
@@ -270,6 +343,12 @@ SubmodelType CompiledModel::getSubmodelType(
         return SubmodelType::Software;
     }
 
+    // batches exceeding hardware grouping are tiled by software
+    if (INTEL_AFFINE == layer.Operation && layer.Input.Grouping > LayerCapabilities::InputGroupsCountMax)
+    {
+        return SubmodelType::Software;
+    }
+
     if (hwCaps.IsLayerSupported(layer.Operation))
     {
         return SubmodelType::Hardware;
@@ -22,6 +22,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <vector>
 
@@ -63,6 +64,11 @@ public:
 
     void BuildHardwareModel(DriverInterface &ddi);
 
+    void PackWeights()
+    {
+        softwareModel.PackWeights();
+    }
+
     std::vector<std::unique_ptr<Layer>> const & GetLayers() const
     {
         return softwareModel.GetLayers();
@@ -88,10 +94,35 @@ public:
 
     Memory const * GetMemoryIfNotPartOfModel(const void *buffer, size_t bufferSize) const;
 
-    Gna2Status Score(
+    /**
+     * Scores request and reports its status with onCompleted.
+     * When last sub-model is processed by hardware, returns just after submitting it
+     * and onCompleted is called from driver completion thread.
+     */
+    void Score(
         RequestConfiguration& config,
         RequestProfiler *profiler,
-        KernelBuffers *buffers);
+        KernelBuffers *buffers,
+        HardwareModelScorable::ScoreCompletion const & onCompleted);
+
+    using BatchCompletion = std::function<void(uint32_t requestIndex, Gna2Status status)>;
+
+    /**
+     * Scores batch of count requests accepted by IsBatchable and CanScoreInBatch
+     * together in software and reports status of each request with onCompleted.
+     */
+    void ScoreBatch(
+        RequestConfiguration * const * configs,
+        RequestProfiler * const * profilers,
+        uint32_t count,
+        KernelBuffers *buffers,
+        BatchCompletion const & onCompleted);
+
+    // True when request with config is scored in software without features preventing batching
+    bool IsBatchable(RequestConfiguration & config);
+
+    // True when requests of both batchable configs may be scored in the same batch
+    bool CanScoreInBatch(RequestConfiguration const & config, RequestConfiguration const & other) const;
 
     void ValidateBuffer(MemoryContainer const & requestAllocations, Memory const & memory) const;
 
@@ -128,8 +159,10 @@ private:
 
     AccelerationType getEffectiveAccelerationMode(RequestConfiguration& config);
 
-    uint32_t scoreAllSubModels(RequestConfiguration& config,
-        RequestProfiler *profiler, KernelBuffers *buffers);
+    // Returns true when last sub-model was submitted to device and onCompleted is called on its completion
+    bool scoreAllSubModels(RequestConfiguration& config,
+        RequestProfiler *profiler, KernelBuffers *buffers, uint32_t & saturationCount,
+        HardwareModelScorable::ScoreCompletion const & onCompleted);
 
     BaseValidator makeValidator();
     static uint32_t GetNumberOfOperations(const Gna2Model& model)
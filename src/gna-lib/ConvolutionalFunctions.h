@@ -75,7 +75,7 @@ struct ConvolutionFunction
     uint32_t OutputsPerFilterCount;
 
 protected:
-    const KernelMap<ConvolutionKernel>& kernels;
+    const KernelTable<ConvolutionKernel> kernels;
 
     std::unique_ptr<ConvolutionConfig> hiddenConfig;
 
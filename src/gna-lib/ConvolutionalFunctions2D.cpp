@@ -23,6 +23,7 @@
 
 #include <map>
 #include <memory>
+#include <stdexcept>
 #include <utility>
 
 using namespace GNA;
@@ -214,6 +215,27 @@ ConvolutionFunction2D::ConvolutionFunction2D(const BaseTransformConfig<Convoluti
         BaseConfig{ Input->Buffer, Output->Buffer });
 }
 
+void ConvolutionFunction2D::ComputeRows(AccelerationMode accel, LayerConfiguration const * layerConfiguration,
+    ExecutionConfig const & execution, uint32_t firstOutputRow, uint32_t outputRowCount,
+    int8_t * output) const
+{
+    auto const executionConfig = createExecutionConfig(layerConfiguration, execution);
+    auto const & requestConfig = *executionConfig.RequestConfig;
+    auto rowsConfig = KernelConfig<ConvolutionConfig2D>{
+        ConvolutionConfig2D{ requestConfig.Transform, firstOutputRow, outputRowCount },
+        BaseConfig{ requestConfig } };
+    rowsConfig.Outputs = output;
+    auto const rowsExecution = ExecutionKernelConfig<ConvolutionConfig2D>{ &rowsConfig, execution };
+    try
+    {
+        kernels.at(accel)(&rowsExecution);
+    }
+    catch (const std::out_of_range&)
+    {
+        throw GnaException(Gna2StatusNotImplemented);
+    }
+}
+
 Tensor const & ConvolutionFunction2D::GetOperand(uint32_t operandIndex) const
 {
     switch (operandIndex)
@@ -35,6 +35,12 @@ struct ConvolutionFunction2D : public Transform<ConvolutionConfig2D, Convolution
 
     virtual Tensor const & GetOperand(uint32_t operandIndex) const override;
 
+    // Computes outputRowCount output rows starting from firstOutputRow into output,
+    // used by layers processing convolution output in bands of rows
+    void ComputeRows(AccelerationMode accel, LayerConfiguration const * layerConfiguration,
+        ExecutionConfig const & execution, uint32_t firstOutputRow, uint32_t outputRowCount,
+        int8_t * output) const;
+
     virtual bool Is1D() const override
     {
         return is1D;
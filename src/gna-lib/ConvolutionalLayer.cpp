@@ -63,11 +63,10 @@ void CnnLayer::Init()
     const auto& declaredOutputPerFilter = Output.AsModelValue('W').SetOperand(OutputOperandIndex);
     ModelErrorHelper::ExpectEqual(declaredOutputPerFilter, outputsPerFilter);
 
-    Layer::ComputeHidden = [this, effectiveComputeHidden](AccelerationMode accel, ExecutionConfig const & executionConfig)
-    {(this->*effectiveComputeHidden)(accel, executionConfig); };
-
-    Layer::Compute = [this, effectiveCompute](LayerConfiguration &layerConfiguration, AccelerationMode accel, ExecutionConfig const & executionConfig)
-    {(this->*effectiveCompute)(layerConfiguration, accel, executionConfig); };
+    setComputeFunctions([this, effectiveComputeHidden](AccelerationMode accel, ExecutionConfig const & executionConfig)
+    {(this->*effectiveComputeHidden)(accel, executionConfig); },
+        [this, effectiveCompute](LayerConfiguration &layerConfiguration, AccelerationMode accel, ExecutionConfig const & executionConfig)
+    {(this->*effectiveCompute)(layerConfiguration, accel, executionConfig); });
 }
 
 Tensor const & CnnLayer::GetOperand(uint32_t operandIndex) const
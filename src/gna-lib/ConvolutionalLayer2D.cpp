@@ -24,6 +24,7 @@
 #include "gna-api-types-xnn.h"
 
 #include <algorithm>
+#include <cstring>
 #include <memory>
 #include <stdexcept>
 
@@ -58,6 +59,127 @@ void ConvolutionalLayer2D::Init()
     Expect::One(Input.at(GNA_DIM_N), Gna2StatusXnnErrorGrouping);
     Expect::One(Output.at(GNA_DIM_N), Gna2StatusXnnErrorGrouping);
     Expect::Equal(Output.Size, GetOutputTransform()->Output->Size, Gna2StatusXnnErrorOutputVolume);
+
+    initFusedCompute();
+}
+
+void ConvolutionalLayer2D::initFusedCompute()
+{
+    auto const convolution = Transforms.Get<ConvolutionFunction2D>(ConvolutionalTransform2D);
+    auto const activation = Transforms.Get<ActivationFunction>(ActivationTransform);
+    auto const pooling = Transforms.Get<PoolingFunction2D>(PoolingTransform2D);
+    if (nullptr == activation && nullptr == pooling)
+    {
+        return;
+    }
+
+    // convolution band of ~128KB int32 outputs
+    constexpr uint32_t bandSizeMax = 128 * 1024;
+    gna_3d_dimensions const convolutionOutput = convolution->Output->Dimensions;
+    bands.OutputHeight = convolutionOutput.height;
+    bands.RowElementCount = convolutionOutput.width * convolutionOutput.depth;
+    bands.BandRowCount = (std::min)(bands.OutputHeight,
+        (std::max)(1u, bandSizeMax / (bands.RowElementCount * static_cast<uint32_t>(sizeof(int32_t)))));
+
+    uint32_t scratchPadSize = 0;
+    if (nullptr != activation)
+    {
+        bands.ConvolutionBandSize = bands.BandRowCount * bands.RowElementCount * sizeof(int32_t);
+        scratchPadSize += bands.ConvolutionBandSize;
+    }
+    if (nullptr != pooling)
+    {
+        bands.PoolingWindowHeight = pooling->Window->at(GNA_DIM_H);
+        bands.PoolingStrideHeight = pooling->Stride->at(GNA_DIM_H);
+        bands.PoolingOutputHeight = pooling->Output->at(GNA_DIM_H);
+        // windows starting past convolution output are not pooled the same by all kernels,
+        // such layers are computed by transforms, as are ones with no window fully covered
+        if (bands.PoolingWindowHeight > bands.OutputHeight
+            || (bands.PoolingOutputHeight - 1) * bands.PoolingStrideHeight >= bands.OutputHeight)
+        {
+            return;
+        }
+        bands.PoolingFullWindowCount =
+            1 + (bands.OutputHeight - bands.PoolingWindowHeight) / bands.PoolingStrideHeight;
+        bands.PoolingRowSize = bands.RowElementCount * pooling->Input->Mode.Size;
+        // rows of pending windows are kept for next band
+        auto const keptRowCountMax = bands.PoolingStrideHeight + bands.PoolingWindowHeight - 1;
+        scratchPadSize += (keptRowCountMax + bands.BandRowCount) * bands.PoolingRowSize;
+    }
+
+    fusedConvolution = convolution;
+    fusedActivation = activation;
+    fusedPooling = pooling;
+    fusedScratchPad = std::make_unique<Tensor>(Shape(GNA_TENSOR_N, scratchPadSize),
+        Gna2DataTypeInt8, Gna2TensorModeDefault, nullptr);
+
+    setComputeFunctions([this](AccelerationMode accel, ExecutionConfig const & executionConfig)
+    {this->computeFused(nullptr, accel, executionConfig); },
+        [this](LayerConfiguration &layerConfiguration, AccelerationMode accel,
+            ExecutionConfig const & executionConfig)
+    {this->computeFused(&layerConfiguration, accel, executionConfig); });
+}
+
+void ConvolutionalLayer2D::computeFused(LayerConfiguration const * layerConfiguration,
+    AccelerationMode accel, ExecutionConfig const & execution) const
+{
+    auto * const convolutionBand = execution.Intermediate->cnnFusedBuffer;
+    auto * const poolingBand = convolutionBand + bands.ConvolutionBandSize;
+    // convolution output row stored at poolingBand start
+    uint32_t poolingBandFirstRow = 0;
+    uint32_t nextPoolingRow = 0;
+
+    for (uint32_t row = 0; row < bands.OutputHeight; row += bands.BandRowCount)
+    {
+        auto const rowCount = (std::min)(bands.BandRowCount, bands.OutputHeight - row);
+        auto const rowEnd = row + rowCount;
+        auto * const rows = (nullptr != fusedPooling)
+            ? poolingBand + (row - poolingBandFirstRow) * bands.PoolingRowSize
+            : nullptr;
+
+        if (nullptr != fusedActivation)
+        {
+            fusedConvolution->ComputeRows(accel, layerConfiguration, execution, row, rowCount, convolutionBand);
+            fusedActivation->ComputePart(accel, layerConfiguration, execution, row * bands.RowElementCount,
+                rowCount * bands.RowElementCount, convolutionBand, rows);
+        }
+        else
+        {
+            fusedConvolution->ComputeRows(accel, layerConfiguration, execution, row, rowCount, rows);
+        }
+
+        if (nullptr == fusedPooling)
+        {
+            continue;
+        }
+
+        // last full window is pooled together with partial ones to keep pooled input not shorter than window
+        auto poolingRowEnd = bands.PoolingOutputHeight;
+        if (rowEnd < bands.OutputHeight)
+        {
+            auto const completeWindowCount = (rowEnd < bands.PoolingWindowHeight) ? 0
+                : 1 + (rowEnd - bands.PoolingWindowHeight) / bands.PoolingStrideHeight;
+            poolingRowEnd = (std::min)(completeWindowCount, bands.PoolingFullWindowCount - 1);
+        }
+        if (poolingRowEnd > nextPoolingRow)
+        {
+            auto const firstInputRow = nextPoolingRow * bands.PoolingStrideHeight;
+            auto const inputRowEnd = (std::min)(rowEnd,
+                (poolingRowEnd - 1) * bands.PoolingStrideHeight + bands.PoolingWindowHeight);
+            fusedPooling->ComputeRows(accel, layerConfiguration, execution, nextPoolingRow,
+                poolingBand + (firstInputRow - poolingBandFirstRow) * bands.PoolingRowSize,
+                inputRowEnd - firstInputRow);
+            nextPoolingRow = poolingRowEnd;
+        }
+
+        auto const keptFirstRow = (std::min)(nextPoolingRow * bands.PoolingStrideHeight, rowEnd);
+        if (keptFirstRow > poolingBandFirstRow)
+        {
+            memmove(poolingBand, poolingBand + (keptFirstRow - poolingBandFirstRow) * bands.PoolingRowSize,
+                static_cast<size_t>(rowEnd - keptFirstRow) * bands.PoolingRowSize);
+            poolingBandFirstRow = keptFirstRow;
+        }
+    }
 }
 
 Tensor const & ConvolutionalLayer2D::GetOperand(uint32_t operandIndex) const
@@ -81,6 +203,10 @@ Tensor const & ConvolutionalLayer2D::GetOperand(uint32_t operandIndex) const
     }
     case SoftwareScratchpadOperandIndex:
     {
+        if (fusedScratchPad)
+        {
+            return *fusedScratchPad;
+        }
         if (Transforms.size() > 1)
         {
             return inputTransform->GetOperand(OutputOperandIndex);
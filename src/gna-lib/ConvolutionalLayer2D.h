@@ -9,9 +9,15 @@
 
 #include "common.h"
 
+#include <cstdint>
+#include <memory>
+
 namespace GNA
 {
+class ActivationFunction;
 class BaseValidator;
+struct ConvolutionFunction2D;
+class PoolingFunction2D;
 
 class ConvolutionalLayer2D : public Layer
 {
@@ -30,6 +36,40 @@ public:
 protected:
     virtual DataConfig GetDataMode() const override;
     void Init();
+
+private:
+    // Geometry of convolution output processed in bands of rows
+    struct FusedBands
+    {
+        uint32_t OutputHeight;
+        uint32_t RowElementCount;
+        uint32_t BandRowCount;
+        // size of convolution band activated from, zero without activation
+        uint32_t ConvolutionBandSize;
+        // size of single row of pooling input
+        uint32_t PoolingRowSize;
+        uint32_t PoolingWindowHeight;
+        uint32_t PoolingStrideHeight;
+        uint32_t PoolingOutputHeight;
+        // number of pooling windows fully covered by convolution output
+        uint32_t PoolingFullWindowCount;
+    };
+
+    void initFusedCompute();
+
+    // Computes, activates and pools convolution output in bands of rows,
+    // so working set fits L2 cache instead of whole convolution output
+    void computeFused(LayerConfiguration const * layerConfiguration, AccelerationMode accel,
+        ExecutionConfig const & execution) const;
+
+    FusedBands bands = {};
+
+    ConvolutionFunction2D const * fusedConvolution = nullptr;
+    ActivationFunction const * fusedActivation = nullptr;
+    PoolingFunction2D const * fusedPooling = nullptr;
+
+    // software scratch pad holding bands of convolution output
+    std::unique_ptr<Tensor> fusedScratchPad;
 };
 
 }
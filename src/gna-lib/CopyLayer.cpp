@@ -59,11 +59,10 @@ CopyLayer::CopyLayer(const nn_layer& layer, const BaseValidator& validatorIn) :
         Validator{ *validator, limits });
     Expect::True(RowCount <= Input.Dimensions.at('H'), Gna2StatusXnnErrorLyrCfg);
 
-    ComputeHidden = [this](AccelerationMode accel, ExecutionConfig const & executionConfig)
-                    {this->computeHidden(accel, executionConfig); };
-
-    Compute = [this](LayerConfiguration &layerConfiguration, AccelerationMode accel, ExecutionConfig const & executionConfig)
-                    {this->compute(layerConfiguration, accel, executionConfig); };
+    setComputeFunctions([this](AccelerationMode accel, ExecutionConfig const & executionConfig)
+                    {this->computeHidden(accel, executionConfig); },
+        [this](LayerConfiguration &layerConfiguration, AccelerationMode accel, ExecutionConfig const & executionConfig)
+                    {this->compute(layerConfiguration, accel, executionConfig); });
 }
 
 CopyLayer::CopyLayer(const Gna2Operation& operation, const BaseValidator& validatorIn) :
@@ -84,11 +83,10 @@ CopyLayer::CopyLayer(const Gna2Operation& operation, const BaseValidator& valida
         e.SetParameterIndex(0);
         throw;
     }
-    ComputeHidden = [this](AccelerationMode accel, ExecutionConfig const & executionConfig)
-    {this->computeHidden(accel, executionConfig); };
-
-    Compute = [this](LayerConfiguration &layerConfiguration, AccelerationMode accel, ExecutionConfig const & executionConfig)
-    {this->compute(layerConfiguration, accel, executionConfig); };
+    setComputeFunctions([this](AccelerationMode accel, ExecutionConfig const & executionConfig)
+    {this->computeHidden(accel, executionConfig); },
+        [this](LayerConfiguration &layerConfiguration, AccelerationMode accel, ExecutionConfig const & executionConfig)
+    {this->compute(layerConfiguration, accel, executionConfig); });
 }
 
 void CopyLayer::UpdateKernelConfigs(LayerConfiguration& layerConfiguration) const
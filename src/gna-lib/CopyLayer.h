@@ -33,7 +33,7 @@ private:
     void computeHidden(AccelerationMode accel, ExecutionConfig const & executionConfig) const;
     void compute(const LayerConfiguration& layerConfiguration, AccelerationMode accel, ExecutionConfig const & executionConfig) const;
 
-    const KernelMap<CopyKernel>& copyKernels;
+    const KernelTable<CopyKernel> copyKernels;
     CopyConfig copyHiddenConfig;
     static const FullCapabilitiesMap limits;
 };
@@ -62,6 +62,26 @@ void Device::SetNumberOfThreads(uint32_t threadCount)
     requestHandler.ChangeNumberOfThreads(threadCount);
 }
 
+void Device::SetRequestBatching(uint32_t maxBatchSize, uint32_t maxWaitMicroseconds)
+{
+    requestHandler.SetRequestBatching(maxBatchSize, maxWaitMicroseconds);
+}
+
+void Device::SetRequestQueueCapacity(uint32_t capacity, uint32_t enqueueTimeoutMilliseconds)
+{
+    requestHandler.SetQueueCapacity(capacity, enqueueTimeoutMilliseconds);
+}
+
+void Device::SetThreadAffinity(std::vector<uint32_t> const & cpus)
+{
+    requestHandler.SetThreadAffinity(cpus);
+}
+
+void Device::SetWeightPacking(bool enabled)
+{
+    weightPacking = enabled;
+}
+
 void Device::AttachBuffer(uint32_t configId,
     uint32_t operandIndex, uint32_t layerIndex, void *address)
 {
@@ -100,6 +120,37 @@ void Device::EnforceAcceleration(uint32_t configId, Gna2AccelerationMode accelMo
     requestConfiguration.EnforceAcceleration(accelMode);
 }
 
+void Device::EnableParallelExecution(uint32_t configId)
+{
+    auto& requestConfiguration = requestBuilder.GetConfiguration(configId);
+    requestConfiguration.ParallelWorkers = &requestHandler.GetThreadPool();
+}
+
+void Device::SetRequestPriority(uint32_t configId, Gna2RequestPriority priority)
+{
+    auto& requestConfiguration = requestBuilder.GetConfiguration(configId);
+    requestConfiguration.SetPriority(priority);
+}
+
+void Device::SetRequestDeadline(uint32_t configId, uint32_t microseconds)
+{
+    auto& requestConfiguration = requestBuilder.GetConfiguration(configId);
+    requestConfiguration.DeadlineMicroseconds = microseconds;
+}
+
+void Device::SetCompletionCallback(uint32_t configId, Gna2RequestCompletionCallback callback, void * userData)
+{
+    auto& requestConfiguration = requestBuilder.GetConfiguration(configId);
+    requestConfiguration.CompletionCallback = callback;
+    requestConfiguration.CompletionCallbackData = userData;
+}
+
+void Device::SetCompletionEvent(uint32_t configId, int eventFd)
+{
+    auto& requestConfiguration = requestBuilder.GetConfiguration(configId);
+    requestConfiguration.SetCompletionEvent(eventFd);
+}
+
 void Device::AttachActiveList(uint32_t configId, uint32_t layerIndex,
         uint32_t indicesCount, const uint32_t* const indices)
 {
@@ -153,9 +204,17 @@ Gna2Status Device::WaitForRequest(uint32_t requestId, uint32_t milliseconds)
     return requestHandler.WaitFor(requestId, milliseconds);
 }
 
+Gna2Status Device::WaitForAnyRequest(uint32_t requestCount, uint32_t const * requestIds, uint32_t milliseconds,
+    uint32_t & completedCount, uint32_t * completedIds, Gna2Status * completedStatuses)
+{
+    return requestHandler.WaitForAny(requestCount, requestIds, milliseconds,
+        completedCount, completedIds, completedStatuses);
+}
+
 void Device::Stop()
 {
     requestHandler.StopRequests();
+    driverInterface->WaitForCompletions();
 }
 
 void Device::SetInstrumentationUnit(uint32_t configId, Gna2InstrumentationUnit instrumentationUnit)
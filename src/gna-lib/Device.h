@@ -40,6 +40,15 @@ public:
 
     void SetNumberOfThreads(uint32_t threadCount);
 
+    void SetRequestBatching(uint32_t maxBatchSize, uint32_t maxWaitMicroseconds);
+
+    void SetRequestQueueCapacity(uint32_t capacity, uint32_t enqueueTimeoutMilliseconds);
+
+    void SetThreadAffinity(std::vector<uint32_t> const & cpus);
+
+    // Enables repacking of weights of models loaded afterwards
+    void SetWeightPacking(bool enabled);
+
     template<class T>
     uint32_t LoadModel(const T& model)
     {
@@ -54,6 +63,10 @@ public:
         auto modelId = modelIdSequence++;
 
         compiledModel->BuildHardwareModel(*driverInterface);
+        if (weightPacking)
+        {
+            compiledModel->PackWeights();
+        }
         models.emplace(modelId, std::move(compiledModel));
         return modelId;
     }
@@ -70,12 +83,25 @@ public:
 
     void EnforceAcceleration(uint32_t configId, Gna2AccelerationMode accel);
 
+    void EnableParallelExecution(uint32_t configId);
+
+    void SetRequestPriority(uint32_t configId, Gna2RequestPriority priority);
+
+    void SetRequestDeadline(uint32_t configId, uint32_t microseconds);
+
+    void SetCompletionCallback(uint32_t configId, Gna2RequestCompletionCallback callback, void * userData);
+
+    void SetCompletionEvent(uint32_t configId, int eventFd);
+
     void AttachActiveList(uint32_t configId, uint32_t layerIndex, uint32_t indicesCount, const uint32_t* const indices);
 
     void PropagateRequest(uint32_t configId, uint32_t *requestId);
 
     Gna2Status WaitForRequest(uint32_t requestId, uint32_t milliseconds);
 
+    Gna2Status WaitForAnyRequest(uint32_t requestCount, uint32_t const * requestIds, uint32_t milliseconds,
+        uint32_t & completedCount, uint32_t * completedIds, Gna2Status * completedStatuses);
+
     void Stop();
 
     void* Dump(uint32_t modelId, Gna2ModelSueCreekHeader* modelHeader, Gna2Status* status,
@@ -127,5 +153,7 @@ protected:
 
 private:
     uint32_t numberOfThreads;
+
+    bool weightPacking = false;
 };
 }
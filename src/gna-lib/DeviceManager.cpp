@@ -127,6 +127,32 @@ uint32_t DeviceManager::GetThreadCount(uint32_t deviceIndex)
     return device.GetNumberOfThreads();
 }
 
+void DeviceManager::SetRequestBatching(uint32_t deviceIndex, uint32_t maxBatchSize,
+    uint32_t maxWaitMicroseconds)
+{
+    auto& device = GetDevice(deviceIndex);
+    device.SetRequestBatching(maxBatchSize, maxWaitMicroseconds);
+}
+
+void DeviceManager::SetRequestQueueCapacity(uint32_t deviceIndex, uint32_t capacity,
+    uint32_t enqueueTimeoutMilliseconds)
+{
+    auto& device = GetDevice(deviceIndex);
+    device.SetRequestQueueCapacity(capacity, enqueueTimeoutMilliseconds);
+}
+
+void DeviceManager::SetThreadAffinity(uint32_t deviceIndex, std::vector<uint32_t> const & cpus)
+{
+    auto& device = GetDevice(deviceIndex);
+    device.SetThreadAffinity(cpus);
+}
+
+void DeviceManager::SetWeightPacking(uint32_t deviceIndex, bool enabled)
+{
+    auto& device = GetDevice(deviceIndex);
+    device.SetWeightPacking(enabled);
+}
+
 void DeviceManager::OpenDevice(uint32_t deviceIndex)
 {
     Expect::InRange(deviceIndex, GetDeviceCount() - 1, Gna2StatusIdentifierInvalid);
@@ -155,6 +181,8 @@ void DeviceManager::CloseDevice(uint32_t deviceIndex)
 
         if (deviceRefCount == 0)
         {
+            // requests submitted to hardware have to complete before memory is unmapped
+            GetDevice(deviceIndex).Stop();
             UnMapAllFromDevice(GetDevice(deviceIndex));
             devices.erase(deviceIndex);
         }
@@ -197,18 +225,33 @@ void DeviceManager::AllocateMemory(uint32_t requestedSize,
 
     *memoryAddress = memoryObject->GetBuffer();
     *sizeGranted = (uint32_t)memoryObject->GetSize();
-    memoryObjects.emplace_back(std::move(memoryObject));
+    memoryObjects.emplace(memoryObject->GetBuffer(), std::move(memoryObject));
+}
+
+std::pair<bool, std::map<void const *, std::unique_ptr<Memory>>::const_iterator> DeviceManager::HasMemory(void * buffer) const
+{
+    auto memoryIterator = memoryObjects.find(buffer);
+    return { memoryIterator != memoryObjects.end(), memoryIterator };
 }
 
-std::pair<bool, std::vector<std::unique_ptr<Memory>>::const_iterator> DeviceManager::HasMemory(void * buffer) const
+Memory const * DeviceManager::FindMemory(const void * buffer, size_t bufferSize) const
 {
-    auto memoryIterator = std::find_if(memoryObjects.cbegin(), memoryObjects.cend(),
-        [buffer](const std::unique_ptr<Memory>& memory)
+    auto memoryIterator = memoryObjects.upper_bound(buffer);
+    if (memoryIterator == memoryObjects.begin())
+    {
+        return nullptr;
+    }
+    auto const & memory = *(--memoryIterator)->second;
+    if (Expect::InMemoryRange(buffer, bufferSize, memory.GetBuffer(), memory.GetSize()))
     {
-        return memory->GetBuffer() == buffer;
-    });
+        return &memory;
+    }
+    return nullptr;
+}
 
-    return { memoryIterator != memoryObjects.end(), memoryIterator };
+void DeviceManager::SetHugePages(bool enabled)
+{
+    memoryArena.SetHugePages(enabled);
 }
 
 void DeviceManager::FreeMemory(void *buffer)
@@ -272,16 +315,11 @@ Device & DeviceManager::GetDeviceForRequestId(uint32_t requestId)
     throw GnaException(Gna2StatusIdentifierInvalid);
 }
 
-const std::vector<std::unique_ptr<Memory>> & DeviceManager::GetAllAllocated() const
-{
-    return memoryObjects;
-}
-
 void DeviceManager::UnMapAllFromDevice(Device& device)
 {
     for (auto& m : memoryObjects)
     {
-        device.UnMapMemory(*m);
+        device.UnMapMemory(*m.second);
     }
 }
 
@@ -289,11 +327,11 @@ void DeviceManager::MapAllToDevice(Device& device)
 {
     for (auto& m : memoryObjects)
     {
-        device.MapMemory(*m);
+        device.MapMemory(*m.second);
     }
 }
 
 std::unique_ptr<Memory> DeviceManager::createMemoryObject(uint32_t requestedSize)
 {
-    return std::make_unique<Memory>(requestedSize);
+    return std::make_unique<Memory>(requestedSize, memoryArena);
 }
@@ -6,10 +6,12 @@
 #pragma once
 
 #include "Device.h"
+#include "MemoryArena.h"
 
 #include "gna2-common-impl.h"
 
 #include <cstdint>
+#include <map>
 #include <memory>
 #include <vector>
 
@@ -38,6 +40,14 @@ public:
 
     uint32_t GetThreadCount(uint32_t deviceIndex);
 
+    void SetRequestBatching(uint32_t deviceIndex, uint32_t maxBatchSize, uint32_t maxWaitMicroseconds);
+
+    void SetRequestQueueCapacity(uint32_t deviceIndex, uint32_t capacity, uint32_t enqueueTimeoutMilliseconds);
+
+    void SetThreadAffinity(uint32_t deviceIndex, std::vector<uint32_t> const & cpus);
+
+    void SetWeightPacking(uint32_t deviceIndex, bool enabled);
+
     void OpenDevice(uint32_t deviceIndex);
 
     void CloseDevice(uint32_t deviceIndex);
@@ -46,9 +56,12 @@ public:
     Device* TryGetDeviceForModel(uint32_t modelId);
 
     void AllocateMemory(uint32_t requestedSize, uint32_t * sizeGranted, void **memoryAddress);
-    std::pair<bool, std::vector<std::unique_ptr<Memory>>::const_iterator> HasMemory(void * buffer) const;
+    std::pair<bool, std::map<void const *, std::unique_ptr<Memory>>::const_iterator> HasMemory(void * buffer) const;
     void FreeMemory(void * memory);
 
+    // Enables backing of memory allocated afterwards by huge pages
+    void SetHugePages(bool enabled);
+
     void MapMemoryToAll(Memory& memoryObject);
     void UnMapMemoryFromAll(Memory& memoryObject);
 
@@ -58,7 +71,8 @@ public:
 
     Device& GetDeviceForRequestId(uint32_t requestId);
 
-    const std::vector<std::unique_ptr<Memory>>& GetAllAllocated() const;
+    // Returns allocated memory containing whole buffer or NULL
+    Memory const * FindMemory(const void * buffer, size_t bufferSize) const;
 
     static constexpr uint32_t DefaultThreadCount = 1;
 
@@ -66,7 +80,7 @@ private:
     void UnMapAllFromDevice(Device& device);
     void MapAllToDevice(Device& device);
 
-    static std::unique_ptr<Memory> createMemoryObject(const uint32_t requestedSize);
+    std::unique_ptr<Memory> createMemoryObject(const uint32_t requestedSize);
 
     static constexpr uint32_t MaximumReferenceCount = 1024;
 
@@ -87,7 +101,11 @@ private:
 
     std::map<uint32_t, HardwareCapabilities> capabilities;
 
-    std::vector<std::unique_ptr<Memory>> memoryObjects;
+    // declared before memory objects, as they return their buffers to arena when destroyed
+    MemoryArena memoryArena;
+
+    // indexed by buffer address, allocations do not overlap
+    std::map<void const *, std::unique_ptr<Memory>> memoryObjects;
 };
 
 }
@@ -12,6 +12,7 @@
 
 #include "gna2-common-impl.h"
 
+#include <functional>
 #include <map>
 
 namespace GNA
@@ -80,6 +81,8 @@ class DriverInterface
 public:
     static constexpr uint8_t MAX_GNA_DEVICES = 16;
 
+    using CompletionCallback = std::function<void(RequestResult const & result)>;
+
     virtual bool OpenDevice(uint32_t deviceIndex) = 0;
 
     virtual ~DriverInterface() = default;
@@ -93,6 +96,22 @@ public:
     virtual RequestResult Submit(
         HardwareRequest& hardwareRequest, RequestProfiler * const profiler) const = 0;
 
+    /**
+     Submits request to device, onCompleted is called with result when device completes it.
+     May return before completion, then onCompleted is called from driver completion thread.
+     Throws when request could not be submitted, then onCompleted is not called.
+     Default implementation waits for completion in calling thread.
+     */
+    virtual void SubmitAsync(HardwareRequest& hardwareRequest, RequestProfiler * const profiler,
+        CompletionCallback onCompleted) const
+    {
+        onCompleted(Submit(hardwareRequest, profiler));
+    }
+
+    // Waits until all requests submitted with SubmitAsync are completed
+    virtual void WaitForCompletions() const
+    {}
+
 protected:
     DriverInterface() = default;
     DriverInterface(const DriverInterface &) = delete;
@@ -64,6 +64,42 @@ uint32_t HardwareModelScorable::Score(
 {
     UNREFERENCED_PARAMETER(buffers);
 
+    RequestResult result = {};
+    {
+        std::lock_guard<std::mutex> lockGuard(hardwareRequestsLock);
+        auto & hwRequest = prepareRequest(layerIndex, layerCount, requestConfiguration, profiler);
+        result = driverInterface.Submit(hwRequest, profiler);
+    }
+    saveResults(result, profiler);
+
+    if (result.status != Gna2StatusSuccess && result.status != Gna2StatusWarningArithmeticSaturation)
+    {
+        throw GnaException(result.status);
+    }
+
+    return (Gna2StatusWarningArithmeticSaturation == result.status) ? 1 : 0;
+}
+
+void HardwareModelScorable::ScoreAsync(
+    uint32_t layerIndex,
+    uint32_t layerCount,
+    const RequestConfiguration& requestConfiguration,
+    RequestProfiler *profiler,
+    ScoreCompletion onCompleted)
+{
+    std::lock_guard<std::mutex> lockGuard(hardwareRequestsLock);
+    auto & hwRequest = prepareRequest(layerIndex, layerCount, requestConfiguration, profiler);
+    driverInterface.SubmitAsync(hwRequest, profiler,
+        [profiler, onCompleted](RequestResult const & result)
+        {
+            saveResults(result, profiler);
+            onCompleted(result.status);
+        });
+}
+
+HardwareRequest & HardwareModelScorable::prepareRequest(uint32_t layerIndex, uint32_t layerCount,
+    const RequestConfiguration& requestConfiguration, RequestProfiler *profiler)
+{
     if (layerIndex + layerCount > hardwareLayers.size())
     {
         throw GnaException(Gna2StatusXnnErrorNetLyrNo);
@@ -94,26 +130,25 @@ uint32_t HardwareModelScorable::Score(
     auto configId = requestConfiguration.Id;
     HardwareRequest *hwRequest = nullptr;
 
+    if (hardwareRequests.find(configId) == hardwareRequests.end())
     {
-        std::lock_guard<std::mutex> lockGuard(hardwareRequestsLock);
-        if (hardwareRequests.find(configId) == hardwareRequests.end())
-        {
-            auto const inserted = hardwareRequests.emplace(
-                configId,
-                std::make_unique<HardwareRequest>(*this, requestConfiguration, allocations));
-            hwRequest = inserted.first->second.get();
-        }
-        else
-        {
-            hwRequest = hardwareRequests.at(configId).get();
-        }
+        auto const inserted = hardwareRequests.emplace(
+            configId,
+            std::make_unique<HardwareRequest>(*this, requestConfiguration, allocations));
+        hwRequest = inserted.first->second.get();
+    }
+    else
+    {
+        hwRequest = hardwareRequests.at(configId).get();
     }
     hwRequest->Update(layerIndex, layerCount, operationMode);
 
     profiler->Measure(Gna2InstrumentationPointLibExecution);
+    return *hwRequest;
+}
 
-    auto const result = driverInterface.Submit(*hwRequest, profiler);
-
+void HardwareModelScorable::saveResults(RequestResult const & result, RequestProfiler *profiler)
+{
     if (profiler != nullptr)
     {
         profiler->AddResults(Gna2InstrumentationPointDrvPreprocessing, result.driverPerf.Preprocessing);
@@ -124,13 +159,6 @@ uint32_t HardwareModelScorable::Score(
         profiler->AddResults(Gna2InstrumentationPointHwTotalCycles, result.hardwarePerf.total);
         profiler->AddResults(Gna2InstrumentationPointHwStallCycles, result.hardwarePerf.stall);
     }
-
-    if (result.status != Gna2StatusSuccess && result.status != Gna2StatusWarningArithmeticSaturation)
-    {
-        throw GnaException(result.status);
-    }
-
-    return (Gna2StatusWarningArithmeticSaturation == result.status) ? 1 : 0;
 }
 
 void HardwareModelScorable::ValidateConfigBuffer(MemoryContainer const & requestAllocations,
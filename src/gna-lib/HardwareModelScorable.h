@@ -16,8 +16,10 @@
 #include "gna-api.h"
 
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <map>
+#include <mutex>
 #include <vector>
 
 namespace GNA
@@ -46,6 +48,20 @@ public:
         RequestProfiler *profiler,
         KernelBuffers *buffers) override;
 
+    using ScoreCompletion = std::function<void(Gna2Status status)>;
+
+    /**
+     * Submits layers to device and returns without waiting for completion,
+     * onCompleted is called with scoring status from driver completion thread.
+     * Throws when layers could not be submitted, then onCompleted is not called.
+     */
+    void ScoreAsync(
+        uint32_t layerIndex,
+        uint32_t layerCount,
+        const RequestConfiguration& requestConfiguration,
+        RequestProfiler *profiler,
+        ScoreCompletion onCompleted);
+
     uint32_t GetBufferOffsetForConfiguration(
         const BaseAddress& address,
         const RequestConfiguration& requestConfiguration) const;
@@ -57,9 +73,17 @@ protected:
     DriverInterface &driverInterface;
 
     std::map<uint32_t, std::unique_ptr<HardwareRequest>> hardwareRequests;
+    // guards hardware requests from update until submitted to driver
     std::mutex hardwareRequestsLock;
 
     virtual void prepareAllocationsAndModel() override;
+
+private:
+    // called under hardwareRequestsLock
+    HardwareRequest & prepareRequest(uint32_t layerIndex, uint32_t layerCount,
+        const RequestConfiguration& requestConfiguration, RequestProfiler *profiler);
+
+    static void saveResults(RequestResult const & result, RequestProfiler *profiler);
 };
 
 }
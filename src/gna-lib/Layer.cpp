@@ -259,6 +259,13 @@ void Layer::initComputeFunctions()
     {this->compute(&layerConfiguration, accel, executionConfig); };
 }
 
+void Layer::setComputeFunctions(ComputeHiddenFunction computeHiddenFunction, ComputeFunction computeFunction)
+{
+    ComputeHidden = std::move(computeHiddenFunction);
+    Compute = std::move(computeFunction);
+    isComputedByTransforms = false;
+}
+
 void Layer::compute(const LayerConfiguration* layerConfiguration, AccelerationMode accel,
     ExecutionConfig const& execution) const
 {
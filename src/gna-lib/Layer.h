@@ -32,6 +32,17 @@ namespace GNA
 class BufferMap;
 struct LayerConfiguration;
 
+// Configurations of requests computing layer together in batched software inference
+struct LayerBatch
+{
+    uint32_t Count;
+
+    // NULL when request has no layer specific configuration
+    LayerConfiguration * Configurations[XNN_N_GROUP_MAX];
+
+    ExecutionConfig const * Executions[XNN_N_GROUP_MAX];
+};
+
 class AbstractOperation
 {
 public:
@@ -66,9 +77,24 @@ public:
         return static_cast<const X*>(this);
     }
 
+    using ComputeHiddenFunction = std::function<void(AccelerationMode accel, ExecutionConfig const & executionConfig)>;
+    using ComputeFunction = std::function<void(LayerConfiguration &layerConfiguration, AccelerationMode accel, ExecutionConfig const & executionConfig)>;
+    using ComputeBatchFunction = std::function<bool(LayerBatch const & batch, AccelerationMode accel)>;
+
     virtual ~Layer() = default;
-    std::function<void(AccelerationMode accel, ExecutionConfig const & executionConfig)> ComputeHidden;
-    std::function<void(LayerConfiguration &layerConfiguration, AccelerationMode accel, ExecutionConfig const & executionConfig)> Compute;
+    ComputeHiddenFunction ComputeHidden;
+    ComputeFunction Compute;
+
+    // Computes layer for all requests of batch at once, returns false when not possible for given batch,
+    // empty when layer is always computed per request
+    ComputeBatchFunction ComputeBatch;
+
+    // True when layer is computed by running its Transforms in order,
+    // thus transforms may be called directly instead of compute functions
+    bool IsComputedByTransforms() const
+    {
+        return isComputedByTransforms;
+    }
 
     virtual void UpdateKernelConfigs(LayerConfiguration& layerConfiguration) const;
     virtual DataConfig GetDataMode() const;
@@ -130,6 +156,9 @@ protected:
 
     void initComputeFunctions();
 
+    // Replaces transform based compute functions with layer specific ones
+    void setComputeFunctions(ComputeHiddenFunction computeHiddenFunction, ComputeFunction computeFunction);
+
     void compute(const LayerConfiguration* layerConfiguration,
         AccelerationMode accel, ExecutionConfig const & execution) const;
 
@@ -142,6 +171,8 @@ private:
     void addBufferAs(const BufferMap& source, uint32_t sourceType,
         BufferMap& destination, uint32_t destinationType) const;
 
+    bool isComputedByTransforms = true;
+
     bool has1BInputAnd2BWeight = false;
     bool is1BInputAnd2BWeightVerified = false;
 };
@@ -100,3 +100,27 @@ const RangeLimits<>& LayerCapabilities::limitsForOutputGroupsMax()
     };
     return _limitsForInputGroupsMax;
 }
+
+const RangeLimits<>& LayerCapabilities::limitsForInputGroupsSoftwareMax()
+{
+    static const RangeLimits<> _limitsForInputGroupsSoftwareMax =
+    {
+        1,
+        SoftwareInputGroupsCountMax,
+        1,
+        Gna2StatusXnnErrorInputVolume
+    };
+    return _limitsForInputGroupsSoftwareMax;
+}
+
+const RangeLimits<>& LayerCapabilities::limitsForOutputGroupsSoftwareMax()
+{
+    static const RangeLimits<> _limitsForOutputGroupsSoftwareMax =
+    {
+        1,
+        SoftwareInputGroupsCountMax,
+        1,
+        Gna2StatusXnnErrorOutputVolume
+    };
+    return _limitsForOutputGroupsSoftwareMax;
+}
@@ -23,6 +23,9 @@ struct LayerCapabilities
     /** Number of input groups constraint - max */
     static constexpr uint32_t InputGroupsCountMax = 8;
 
+    /** Number of input groups constraint for fully connected affine layer tiled by software - max */
+    static constexpr uint32_t SoftwareInputGroupsCountMax = 1024;
+
     /** Total number of input elements constraint - must be multiple of */
     static constexpr uint32_t InputElementsMultipllier = 8;
 
@@ -62,6 +65,10 @@ struct LayerCapabilities
     static const RangeLimits<>& limitsForInputGroupsMax();
 
     static const RangeLimits<>& limitsForOutputGroupsMax();
+
+    static const RangeLimits<>& limitsForInputGroupsSoftwareMax();
+
+    static const RangeLimits<>& limitsForOutputGroupsSoftwareMax();
 };
 
 }
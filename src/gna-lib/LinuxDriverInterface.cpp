@@ -67,6 +67,16 @@ bool LinuxDriverInterface::OpenDevice(uint32_t deviceIndex)
 
 LinuxDriverInterface::~LinuxDriverInterface()
 {
+    {
+        std::lock_guard<std::mutex> lock(completionLock);
+        stopCompletion = true;
+        completionCondition.notify_all();
+    }
+    if (completionThread.joinable())
+    {
+        completionThread.join();
+    }
+
     if (gnaFileDescriptor != -1)
     {
         close(gnaFileDescriptor);
@@ -99,9 +109,56 @@ void LinuxDriverInterface::MemoryUnmap(uint64_t memoryId)
 RequestResult LinuxDriverInterface::Submit(HardwareRequest& hardwareRequest,
                                         RequestProfiler * const profiler) const
 {
-    RequestResult result = { };
-    int ret;
+    auto const requestId = compute(hardwareRequest, profiler);
+    return wait(requestId, hardwareRequest.GetProfilerConfiguration(), profiler);
+}
+
+void LinuxDriverInterface::SubmitAsync(HardwareRequest& hardwareRequest,
+    RequestProfiler * const profiler, CompletionCallback onCompleted) const
+{
+    auto const requestId = compute(hardwareRequest, profiler);
 
+    std::lock_guard<std::mutex> lock(completionLock);
+    submittedRequests.push_back({ requestId, hardwareRequest.GetProfilerConfiguration(),
+        profiler, std::move(onCompleted) });
+    if (!completionThread.joinable())
+    {
+        completionThread = std::thread([this]() { completeRequests(); });
+    }
+    completionCondition.notify_all();
+}
+
+void LinuxDriverInterface::WaitForCompletions() const
+{
+    std::unique_lock<std::mutex> lock(completionLock);
+    completionCondition.wait(lock, [this]() { return submittedRequests.empty(); });
+}
+
+void LinuxDriverInterface::completeRequests() const
+{
+    std::unique_lock<std::mutex> lock(completionLock);
+    while (true)
+    {
+        completionCondition.wait(lock, [this]() { return stopCompletion || !submittedRequests.empty(); });
+        if (submittedRequests.empty())
+        {
+            return;
+        }
+
+        // request stays in queue until completed, so that WaitForCompletions covers it
+        auto const & request = submittedRequests.front();
+        lock.unlock();
+        auto const result = wait(request.Id, request.ProfilerConfig, request.Profiler);
+        request.OnCompleted(result);
+        lock.lock();
+        submittedRequests.pop_front();
+        completionCondition.notify_all();
+    }
+}
+
+uint64_t LinuxDriverInterface::compute(HardwareRequest& hardwareRequest,
+                                        RequestProfiler * const profiler) const
+{
     createRequestDescriptor(hardwareRequest);
 
     gna_compute computeArgs;
@@ -127,18 +184,26 @@ RequestResult LinuxDriverInterface::Submit(HardwareRequest& hardwareRequest,
 
     profiler->Measure(Gna2InstrumentationPointLibDeviceRequestReady);
 
-    ret = ioctl(gnaFileDescriptor, GNA_COMPUTE, &computeArgs);
+    auto const ret = ioctl(gnaFileDescriptor, GNA_COMPUTE, &computeArgs);
     if (ret == -1)
     {
         throw GnaException { Gna2StatusDeviceOutgoingCommunicationError };
     }
 
+    profiler->Measure(Gna2InstrumentationPointLibDeviceRequestSent);
+    return computeArgs.out.request_id;
+}
+
+RequestResult LinuxDriverInterface::wait(uint64_t requestId,
+    ProfilerConfiguration * profilerConfiguration, RequestProfiler * const profiler) const
+{
+    RequestResult result = { };
+
     gna_wait wait_data = {};
-    wait_data.in.request_id = computeArgs.out.request_id;
+    wait_data.in.request_id = requestId;
     wait_data.in.timeout = (driverCapabilities.recoveryTimeout + 1) * 1000;
 
-    profiler->Measure(Gna2InstrumentationPointLibDeviceRequestSent);
-    ret = ioctl(gnaFileDescriptor, GNA_WAIT, &wait_data);
+    auto const ret = ioctl(gnaFileDescriptor, GNA_WAIT, &wait_data);
     profiler->Measure(Gna2InstrumentationPointLibDeviceRequestCompleted);
     if(ret == 0)
     {
@@ -151,7 +216,6 @@ RequestResult LinuxDriverInterface::Submit(HardwareRequest& hardwareRequest,
         result.driverPerf.DeviceRequestCompleted = wait_data.out.drv_perf.hw_completed;
         result.driverPerf.Completion = wait_data.out.drv_perf.completion;
 
-        const auto profilerConfiguration = hardwareRequest.GetProfilerConfiguration();
         if (profilerConfiguration)
         {
             convertDriverPerfResult(profilerConfiguration->GetUnit(), result.driverPerf);
@@ -9,13 +9,18 @@
 
 #include "common.h"
 
+#include <condition_variable>
 #include <cstdint>
+#include <deque>
+#include <mutex>
+#include <thread>
 
 union gna_parameter;
 
 namespace GNA
 {
 class HardwareRequest;
+class ProfilerConfiguration;
 class RequestProfiler;
 
 class LinuxDriverInterface : public DriverInterface
@@ -34,10 +39,33 @@ public:
     virtual RequestResult Submit(HardwareRequest& hardwareRequest,
                                 RequestProfiler * const profiler) const override;
 
+    virtual void SubmitAsync(HardwareRequest& hardwareRequest, RequestProfiler * const profiler,
+        CompletionCallback onCompleted) const override;
+
+    virtual void WaitForCompletions() const override;
+
     LinuxDriverInterface(const LinuxDriverInterface &) = delete;
     LinuxDriverInterface& operator=(const LinuxDriverInterface&) = delete;
 
 private:
+    struct SubmittedRequest
+    {
+        uint64_t Id;
+        ProfilerConfiguration * ProfilerConfig;
+        RequestProfiler * Profiler;
+        CompletionCallback OnCompleted;
+    };
+
+    // Sends request to device and returns driver request id
+    uint64_t compute(HardwareRequest& hardwareRequest, RequestProfiler * const profiler) const;
+
+    // Waits for device to complete request
+    RequestResult wait(uint64_t requestId, ProfilerConfiguration * profilerConfiguration,
+        RequestProfiler * const profiler) const;
+
+    // Completion thread loop, waits for submitted requests in submission order
+    void completeRequests() const;
+
     static void convertDriverPerfResult(Gna2InstrumentationUnit targetUnit, DriverPerfResults & driverPerf);
 
     void createRequestDescriptor(HardwareRequest& hardwareRequest) const override;
@@ -47,6 +75,13 @@ private:
     int discoverDevice(uint32_t deviceIndex, gna_parameter *params, size_t paramsNum);
 
     int gnaFileDescriptor = -1;
+
+    mutable std::mutex completionLock;
+    mutable std::condition_variable completionCondition;
+    // requests sent to device and not yet completed, front one is awaited by completion thread
+    mutable std::deque<SubmittedRequest> submittedRequests;
+    mutable bool stopCompletion = false;
+    mutable std::thread completionThread;
 };
 
 }
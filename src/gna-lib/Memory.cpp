@@ -11,6 +11,7 @@
 #include "Expect.h"
 #include "GnaException.h"
 #include "KernelArguments.h"
+#include "MemoryArena.h"
 
 using namespace GNA;
 
@@ -32,6 +33,17 @@ Memory::Memory(const uint32_t userSize, uint32_t alignment) :
     memset(buffer, 0, size); // this is costly and probably not needed
 }
 
+// sub-allocates and zeros memory from arena
+Memory::Memory(const uint32_t userSize, MemoryArena & arenaIn) :
+    size{ RoundUp(userSize, GNA_BUFFER_ALIGNMENT) },
+    arena{ &arenaIn }
+{
+    Expect::InRange(size, 1u, GNA_MAX_MEMORY_FOR_SINGLE_ALLOC, Gna2StatusMemorySizeInvalid);
+    buffer = arena->Allocate(size);
+    Expect::ValidBuffer(buffer);
+    memset(buffer, 0, size);
+}
+
 Memory::~Memory()
 {
     if (buffer != nullptr && deallocate)
@@ -43,7 +55,14 @@ Memory::~Memory()
             id = 0;
         }
 
-        _gna_free(buffer);
+        if (nullptr != arena)
+        {
+            arena->Free(buffer, size);
+        }
+        else
+        {
+            _gna_free(buffer);
+        }
         buffer = nullptr;
         size = 0;
     }
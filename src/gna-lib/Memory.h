@@ -13,6 +13,7 @@
 namespace GNA
 {
 class DriverInterface;
+class MemoryArena;
 
 class Memory : public BaseAddress
 {
@@ -25,6 +26,9 @@ public:
     // allocates and zeros memory
     Memory(const uint32_t userSize, uint32_t alignment = GNA_BUFFER_ALIGNMENT);
 
+    // sub-allocates and zeros memory from arena
+    Memory(const uint32_t userSize, MemoryArena & arenaIn);
+
     virtual ~Memory();
 
     void Map(DriverInterface& ddi);
@@ -53,6 +57,9 @@ protected:
     bool mapped = false;
 
     bool deallocate = true;
+
+    // when set, buffer is returned to arena instead of being freed
+    MemoryArena * arena = nullptr;
 };
 
 }
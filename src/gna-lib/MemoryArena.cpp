@@ -0,0 +1,183 @@
+/**
+ @copyright (C) 2021 Intel Corporation
+ SPDX-License-Identifier: LGPL-2.1-or-later
+ */
+
+#include "MemoryArena.h"
+
+#include "Expect.h"
+#include "GnaException.h"
+
+#include "common.h"
+#include "gna2-common-api.h"
+
+#include <iterator>
+
+#if !defined(_WIN32)
+#include <sys/mman.h>
+#endif
+
+using namespace GNA;
+
+constexpr uint32_t MemoryArena::RegionSize;
+
+MemoryArena::~MemoryArena()
+{
+    for (auto const & region : regions)
+    {
+        releaseRegion(region.first, region.second);
+    }
+}
+
+void * MemoryArena::Allocate(uint32_t size)
+{
+    auto const blockSize = getBlockSize(size);
+    for (auto & region : regions)
+    {
+        auto const block = tryAllocateFromRegion(region.first, region.second, blockSize);
+        if (nullptr != block)
+        {
+            return block;
+        }
+    }
+    uintptr_t begin;
+    auto & region = createRegion(blockSize, begin);
+    return tryAllocateFromRegion(begin, region, blockSize);
+}
+
+void MemoryArena::Free(void * block, uint32_t size)
+{
+    auto const address = reinterpret_cast<uintptr_t>(block);
+    auto found = regions.upper_bound(address);
+    if (regions.begin() == found)
+    {
+        return;
+    }
+    --found;
+    auto & region = found->second;
+    auto const offset = static_cast<uint32_t>(address - found->first);
+    if (offset >= region.Size)
+    {
+        return;
+    }
+
+    auto freed = region.FreeBlocks.emplace(offset, getBlockSize(size)).first;
+    auto const next = std::next(freed);
+    if (region.FreeBlocks.end() != next && freed->first + freed->second == next->first)
+    {
+        freed->second += next->second;
+        region.FreeBlocks.erase(next);
+    }
+    if (region.FreeBlocks.begin() != freed)
+    {
+        auto const previous = std::prev(freed);
+        if (previous->first + previous->second == freed->first)
+        {
+            previous->second += freed->second;
+            region.FreeBlocks.erase(freed);
+            freed = previous;
+        }
+    }
+
+    if (0 == freed->first && region.Size == freed->second)
+    {
+        releaseRegion(found->first, region);
+        regions.erase(found);
+    }
+}
+
+void MemoryArena::SetHugePages(bool enabled)
+{
+#if defined(_WIN32)
+    Expect::False(enabled, Gna2StatusNotImplemented);
+#endif
+    hugePages = enabled;
+}
+
+uint32_t MemoryArena::getBlockSize(uint32_t size)
+{
+    // blocks are mapped to device separately, thus have to be page aligned
+    return RoundUp(size, PAGE_SIZE);
+}
+
+void * MemoryArena::tryAllocateFromRegion(uintptr_t begin, Region & region, uint32_t blockSize)
+{
+    // first fit keeps large blocks at region begin, aligned to huge page
+    for (auto freeBlock = region.FreeBlocks.begin(); region.FreeBlocks.end() != freeBlock; ++freeBlock)
+    {
+        if (freeBlock->second >= blockSize)
+        {
+            auto const offset = freeBlock->first;
+            auto const remaining = freeBlock->second - blockSize;
+            region.FreeBlocks.erase(freeBlock);
+            if (remaining > 0)
+            {
+                region.FreeBlocks.emplace(offset + blockSize, remaining);
+            }
+            return reinterpret_cast<void *>(begin + offset);
+        }
+    }
+    return nullptr;
+}
+
+MemoryArena::Region & MemoryArena::createRegion(uint32_t blockSize, uintptr_t & begin)
+{
+    auto const regionSize = RoundUp(blockSize, RegionSize);
+    void * memory = nullptr;
+    auto mappedHugePages = false;
+#if !defined(_WIN32)
+    if (hugePages)
+    {
+#if defined(MAP_HUGETLB)
+        memory = mmap(nullptr, regionSize, PROT_READ | PROT_WRITE,
+            MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        mappedHugePages = MAP_FAILED != memory;
+#endif
+        if (!mappedHugePages)
+        {
+            // no huge pages reserved, transparent huge pages are requested instead
+            memory = _mm_malloc(regionSize, RegionSize);
+#if defined(MADV_HUGEPAGE)
+            if (nullptr != memory)
+            {
+                madvise(memory, regionSize, MADV_HUGEPAGE);
+            }
+#endif
+        }
+    }
+    else
+#endif
+    {
+        memory = _gna_malloc(regionSize);
+    }
+    Expect::NotNull(memory, Gna2StatusResourceAllocationError);
+
+    begin = reinterpret_cast<uintptr_t>(memory);
+    try
+    {
+        auto & region = regions[begin];
+        region.Size = regionSize;
+        region.HugePages = mappedHugePages;
+        region.FreeBlocks.emplace(0, regionSize);
+        return region;
+    }
+    catch (std::exception&)
+    {
+        releaseRegion(begin, Region{ regionSize, mappedHugePages, {} });
+        regions.erase(begin);
+        throw GnaException(Gna2StatusResourceAllocationError);
+    }
+}
+
+void MemoryArena::releaseRegion(uintptr_t begin, Region const & region)
+{
+    auto const memory = reinterpret_cast<void *>(begin);
+#if !defined(_WIN32)
+    if (region.HugePages)
+    {
+        munmap(memory, region.Size);
+        return;
+    }
+#endif
+    _gna_free(memory);
+}
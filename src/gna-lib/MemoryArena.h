@@ -0,0 +1,62 @@
+/**
+ @copyright (C) 2021 Intel Corporation
+ SPDX-License-Identifier: LGPL-2.1-or-later
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+
+namespace GNA
+{
+
+/**
+ * Sub-allocates page aligned blocks from large regions,
+ * optionally backed by 2MB huge pages on Linux.
+ * Not thread safe, used under DeviceManager memory management only.
+ */
+class MemoryArena
+{
+public:
+    MemoryArena() = default;
+    MemoryArena(const MemoryArena &) = delete;
+    MemoryArena& operator=(const MemoryArena&) = delete;
+
+    ~MemoryArena();
+
+    // returns page aligned block of at least size bytes
+    void * Allocate(uint32_t size);
+
+    // returns block to its region, region is released when all its blocks are free
+    void Free(void * block, uint32_t size);
+
+    // affects regions created afterwards
+    void SetHugePages(bool enabled);
+
+    static constexpr uint32_t RegionSize = 1 << 21;
+
+private:
+    struct Region
+    {
+        uint32_t Size;
+        bool HugePages;
+        // offset to size of free blocks, adjacent blocks are merged
+        std::map<uint32_t, uint32_t> FreeBlocks;
+    };
+
+    static uint32_t getBlockSize(uint32_t size);
+
+    static void * tryAllocateFromRegion(uintptr_t begin, Region & region, uint32_t blockSize);
+
+    Region & createRegion(uint32_t blockSize, uintptr_t & begin);
+
+    static void releaseRegion(uintptr_t begin, Region const & region);
+
+    // indexed by region begin address
+    std::map<uintptr_t, Region> regions;
+
+    bool hugePages = false;
+};
+
+}
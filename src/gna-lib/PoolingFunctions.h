@@ -52,7 +52,7 @@ struct PoolingFunction
     // Total number of elements in output tensor per filter after pooling.
     uint32_t OutputsPerFilterCount;
 protected:
-    const KernelMap<ConvolutionPoolingKernel>& kernels;
+    const KernelTable<ConvolutionPoolingKernel> kernels;
     const  std::unique_ptr<PoolingConfig> hiddenConfig;
     static const std::map<const nn_operation, const ShapeLimits> windowLimits;
     static const std::map<const nn_operation, const ShapeLimits> strideLimits;
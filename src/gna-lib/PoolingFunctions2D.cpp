@@ -23,6 +23,7 @@
 
 #include <map>
 #include <memory>
+#include <stdexcept>
 #include <utility>
 
 using namespace GNA;
@@ -114,3 +115,29 @@ PoolingFunction2D::PoolingFunction2D(const BaseTransformConfig<PoolingKernel2D>&
     hiddenConfig = std::make_unique<KernelConfig<PoolingConfig2D>>(kernelPoolingConfiguration,
         BaseConfig{ Input->Buffer, Output->Buffer });
 }
+
+void PoolingFunction2D::ComputeRows(AccelerationMode accel, LayerConfiguration const * layerConfiguration,
+    ExecutionConfig const & execution, uint32_t firstOutputRow,
+    int8_t const * input, uint32_t inputRowCount) const
+{
+    auto const executionConfig = createExecutionConfig(layerConfiguration, execution);
+    auto const & requestConfig = *executionConfig.RequestConfig;
+    auto const & pooling = requestConfig.Transform;
+    auto rowsConfig = KernelConfig<PoolingConfig2D>{
+        PoolingConfig2D{ pooling.InputWidth, inputRowCount, pooling.InputDepth,
+            pooling.Mode, pooling.StrideWidth, pooling.StrideHeight,
+            pooling.WindowWidth, pooling.WindowHeight },
+        BaseConfig{ requestConfig } };
+    rowsConfig.Inputs = input;
+    rowsConfig.Outputs += uint64_t{ firstOutputRow } * Output->at(GNA_DIM_W) * Output->at(GNA_DIM_D)
+        * Output->Mode.Size;
+    auto const rowsExecution = ExecutionKernelConfig<PoolingConfig2D>{ &rowsConfig, execution };
+    try
+    {
+        kernels.at(accel)(&rowsExecution);
+    }
+    catch (const std::out_of_range&)
+    {
+        throw GnaException(Gna2StatusNotImplemented);
+    }
+}
@@ -32,6 +32,12 @@ public:
 
     ~PoolingFunction2D() = default;
 
+    // Pools output rows starting from firstOutputRow
+    // of inputRowCount input rows starting at first pooled input row
+    void ComputeRows(AccelerationMode accel, LayerConfiguration const * layerConfiguration,
+        ExecutionConfig const & execution, uint32_t firstOutputRow,
+        int8_t const * input, uint32_t inputRowCount) const;
+
     virtual bool Is1D() const override
     {
         return is1D;
@@ -32,6 +32,7 @@ const std::set<Gna2InstrumentationPoint>& ProfilerConfiguration::GetSupportedIns
         Gna2InstrumentationPointDrvCompletion,
         Gna2InstrumentationPointHwTotalCycles,
         Gna2InstrumentationPointHwStallCycles,
+        Gna2InstrumentationPointLibDeadlineMiss,
     };
     return supportedInstrumentationPoints;
 }
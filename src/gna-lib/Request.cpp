@@ -6,42 +6,120 @@
 #include "CompiledModel.h"
 #include "Request.h"
 #include "RequestConfiguration.h"
+#include "RequestHandler.h"
 
 #include <algorithm>
 #include <cstring>
 #include <memory>
 
+#if !defined(_WIN32)
+#include <unistd.h>
+#endif
+
 struct KernelBuffers;
 
 using namespace GNA;
 
-Request::Request(RequestConfiguration& config, std::unique_ptr<RequestProfiler> profiler) :
-    Configuration(config),
-    Profiler{std::move(profiler)}
+Request::Request(RequestConfiguration& config) :
+    Configuration(config)
 {
-    auto callback = [&](KernelBuffers *buffers, RequestProfiler *profilerPtr)
-    {
-        return Configuration.Model.Score(Configuration, profilerPtr, buffers);
-    };
-    scoreTask = std::packaged_task<Gna2Status(KernelBuffers *buffers, RequestProfiler *profiler)>(callback);
-    future = scoreTask.get_future();
 }
 
-Gna2Status Request::WaitFor(uint64_t milliseconds)
+void Request::Prepare()
+{
+    Profiler = RequestProfiler::Create(Configuration.GetProfilerConfiguration(), std::move(Profiler));
+    Profiler->Measure(Gna2InstrumentationPointLibPreprocessing);
+
+    Id = 0;
+    Handler = nullptr;
+    Completed = false;
+    Status = Gna2StatusSuccess;
+    SignalingThread = std::thread::id();
+    Priority = Configuration.Priority;
+    Deadline = 0 == Configuration.DeadlineMicroseconds
+        ? (std::chrono::steady_clock::time_point::max)()
+        : std::chrono::steady_clock::now() + std::chrono::microseconds(Configuration.DeadlineMicroseconds);
+}
+
+void Request::operator()(KernelBuffers *buffers)
+{
+    Configuration.Model.Score(Configuration, Profiler.get(), buffers,
+        [this](Gna2Status status) { complete(status); });
+}
+
+void Request::complete(Gna2Status status)
 {
-    auto const future_status = future.wait_for(std::chrono::milliseconds(milliseconds));
-    switch (future_status)
+    if (HasDeadline() && std::chrono::steady_clock::now() > Deadline)
     {
-    case std::future_status::ready:
+        Profiler->AddResults(Gna2InstrumentationPointLibDeadlineMiss, 1);
+    }
+
+    // request may be released by callback as soon as it is completed
+    auto const id = Id;
+    auto const handler = Handler;
+    auto const callback = Configuration.CompletionCallback;
+    auto const callbackData = Configuration.CompletionCallbackData;
+    auto const eventFd = Configuration.CompletionEventFd;
+    auto const signaled = nullptr != callback || eventFd >= 0;
+    handler->Complete(*this, status, signaled);
+    if (!signaled)
     {
-        auto const score_status = future.get();
-        Profiler->Measure(Gna2InstrumentationPointLibReceived);
-        Profiler->SaveResults(Configuration.GetProfilerConfiguration());
-        return score_status;
+        return;
     }
-    default:
-        return Gna2StatusWarningDeviceBusy;
+
+    // other threads retrieve request after completion is signaled, so event descriptor is still open
+#if defined(_WIN32)
+    UNREFERENCED_PARAMETER(eventFd);
+#else // linux
+    if (eventFd >= 0)
+    {
+        uint64_t const completed = 1;
+        // counter overflow is not possible with number of requests limited
+        auto const written = write(eventFd, &completed, sizeof(completed));
+        UNREFERENCED_PARAMETER(written);
+    }
+#endif
+    if (nullptr != callback)
+    {
+        callback(id, status, callbackData);
+    }
+    handler->CompletionSignaled(id);
+}
+
+bool Request::IsBatchable() const
+{
+    return Configuration.Model.IsBatchable(Configuration);
+}
+
+bool Request::CanBeBatchedWith(Request const & other) const
+{
+    return Configuration.Model.CanScoreInBatch(Configuration, other.Configuration);
+}
+
+void Request::ScoreBatch(Request * const * batch, uint32_t count, KernelBuffers *buffers)
+{
+    if (1 == count)
+    {
+        batch[0]->operator()(buffers);
+        return;
+    }
+
+    RequestConfiguration * configurations[XNN_N_GROUP_MAX];
+    RequestProfiler * profilers[XNN_N_GROUP_MAX];
+    for (uint32_t i = 0; i < count; i++)
+    {
+        configurations[i] = &batch[i]->Configuration;
+        profilers[i] = batch[i]->Profiler.get();
     }
+    batch[0]->Configuration.Model.ScoreBatch(configurations, profilers, count, buffers,
+        [batch](uint32_t index, Gna2Status status) { batch[index]->complete(status); });
+}
+
+Gna2Status Request::Retrieve()
+{
+    Profiler->Measure(Gna2InstrumentationPointLibReceived);
+    Profiler->SaveResults(Configuration.GetProfilerConfiguration());
+    return Status;
 }
 
 RequestProfiler::RequestProfiler(bool initialize)
@@ -72,6 +150,21 @@ void CycleProfiler::Measure(Gna2InstrumentationPoint pointType)
     getTsc(&Points.at(pointType));
 }
 
+bool MillisecondProfiler::HasUnitOf(ProfilerConfiguration const * config) const
+{
+    return nullptr != config && Gna2InstrumentationUnitMilliseconds == config->GetUnit();
+}
+
+bool MicrosecondProfiler::HasUnitOf(ProfilerConfiguration const * config) const
+{
+    return nullptr != config && Gna2InstrumentationUnitMicroseconds == config->GetUnit();
+}
+
+bool CycleProfiler::HasUnitOf(ProfilerConfiguration const * config) const
+{
+    return nullptr != config && Gna2InstrumentationUnitCycles == config->GetUnit();
+}
+
 void RequestProfiler::SaveResults(ProfilerConfiguration* config)
 {
     uint32_t i = 0;
@@ -81,8 +174,15 @@ void RequestProfiler::SaveResults(ProfilerConfiguration* config)
     }
 }
 
-std::unique_ptr<RequestProfiler> RequestProfiler::Create(ProfilerConfiguration* config)
+std::unique_ptr<RequestProfiler> RequestProfiler::Create(ProfilerConfiguration* config,
+    std::unique_ptr<RequestProfiler> reused)
 {
+    if (reused && reused->HasUnitOf(config))
+    {
+        std::fill(reused->Points.begin(), reused->Points.end(), 0);
+        return reused;
+    }
+
     if (nullptr == config)
     {
         return std::make_unique<DisabledProfiler>();
@@ -123,3 +223,7 @@ void DisabledProfiler::SaveResults(ProfilerConfiguration* config)
 {
     UNREFERENCED_PARAMETER(config);
 }
+bool DisabledProfiler::HasUnitOf(ProfilerConfiguration const * config) const
+{
+    return nullptr == config;
+}
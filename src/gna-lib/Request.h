@@ -10,9 +10,11 @@
 #include "gna2-common-api.h"
 
 #include "gna-api.h"
+#include "gna2-inference-api.h"
 
-#include <future>
+#include <chrono>
 #include <memory>
+#include <thread>
 #include <vector>
 
 struct KernelBuffers;
@@ -21,6 +23,7 @@ namespace GNA
 {
     class ProfilerConfiguration;
     class RequestConfiguration;
+    class RequestHandler;
     class RequestProfiler;
 
 /**
@@ -32,7 +35,9 @@ public:
     static const uint64_t MICROSECOND_MULTIPLIER = 1000000;
     static const uint64_t MILLISECOND_MULTIPLIER = 1000;
 
-    static std::unique_ptr<RequestProfiler> Create(ProfilerConfiguration* config);
+    // Creates profiler for config, reuses given profiler when it measures in the same unit
+    static std::unique_ptr<RequestProfiler> Create(ProfilerConfiguration* config,
+        std::unique_ptr<RequestProfiler> reused = nullptr);
 
     RequestProfiler(bool initialize = true);
     virtual ~RequestProfiler() = default;
@@ -43,6 +48,9 @@ public:
 
     virtual void SaveResults(ProfilerConfiguration* config);
 
+    // True when profiler measures in unit of config or is disabled for NULL config
+    virtual bool HasUnitOf(ProfilerConfiguration const * config) const = 0;
+
     static uint64_t ConvertElapsedTime(uint64_t frequency, uint64_t multiplier,
         uint64_t start, uint64_t stop);
 protected:
@@ -61,55 +69,94 @@ public:
     void Measure(Gna2InstrumentationPoint point) override;
     void AddResults(Gna2InstrumentationPoint point, uint64_t result) override;
     void SaveResults(ProfilerConfiguration* config) override;
+    bool HasUnitOf(ProfilerConfiguration const * config) const override;
 };
 
 class MicrosecondProfiler : public RequestProfiler
 {
 public:
     void Measure(Gna2InstrumentationPoint point) override;
+    bool HasUnitOf(ProfilerConfiguration const * config) const override;
 };
 
 class MillisecondProfiler : public RequestProfiler
 {
 public:
     void Measure(Gna2InstrumentationPoint point) override;
+    bool HasUnitOf(ProfilerConfiguration const * config) const override;
 };
 
 class CycleProfiler : public RequestProfiler
 {
 public:
     void Measure(Gna2InstrumentationPoint point) override;
+    bool HasUnitOf(ProfilerConfiguration const * config) const override;
 };
 
 /**
  * Calculation request for single scoring or propagate forward operation
+ * Requests are pooled by their configuration and prepared again for each enqueuing.
  */
 class Request
 {
 public:
-    Request(RequestConfiguration& config, std::unique_ptr<RequestProfiler> profiler);
+    explicit Request(RequestConfiguration& config);
     ~Request() = default;
     Request() = delete;
     Request(const Request &) = delete;
     Request& operator=(const Request&) = delete;
 
-    Gna2Status WaitFor(uint64_t milliseconds);
+    // Resets request state and profiler to current settings of configuration
+    void Prepare();
+
+    // Saves profiler results of completed request, returns status of its processing
+    Gna2Status Retrieve();
+
+    // Scores request, may return before request is completed by hardware device
+    void operator()(KernelBuffers *buffers);
+
+    // True when request can be scored in batch with other requests
+    bool IsBatchable() const;
 
-    void operator()(KernelBuffers *buffers)
+    // True when batchable request can be scored in the same batch as other one
+    bool CanBeBatchedWith(Request const & other) const;
+
+    // Scores batch of count requests together, completing each of them
+    static void ScoreBatch(Request * const * batch, uint32_t count, KernelBuffers *buffers);
+
+    // True when request is not scheduled in order of enqueuing with default priority
+    bool IsScheduled() const
     {
-        scoreTask(buffers, Profiler.get());
+        return Gna2RequestPriorityNormal != Priority || HasDeadline();
+    }
+
+    bool HasDeadline() const
+    {
+        return (std::chrono::steady_clock::time_point::max)() != Deadline;
     }
 
     // External id (0-GNA_REQUEST_WAIT_ANY)
     uint32_t Id = 0;
+    // Handler notified when request is completed, set when enqueued
+    RequestHandler * Handler = nullptr;
+    // Set by Handler when request is completed, guarded by its lock
+    bool Completed = false;
+    Gna2Status Status = Gna2StatusSuccess;
+    // Thread signaling completion, only this thread can retrieve request until completion is signaled
+    std::thread::id SignalingThread;
+
     RequestConfiguration& Configuration;
 
     std::unique_ptr<RequestProfiler> Profiler;
 
-private:
-    std::packaged_task<Gna2Status(KernelBuffers *buffers, RequestProfiler *profiler)> scoreTask;
+    Gna2RequestPriority Priority = Gna2RequestPriorityNormal;
+
+    // Absolute deadline or max time point when request has no deadline
+    std::chrono::steady_clock::time_point Deadline;
 
-    std::future<Gna2Status> future;
+private:
+    // reports deadline miss and completes request
+    void complete(Gna2Status status);
 };
 
 }
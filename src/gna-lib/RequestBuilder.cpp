@@ -71,10 +71,9 @@ RequestConfiguration& RequestBuilder::GetConfiguration(uint32_t configId) const
 std::unique_ptr<Request> RequestBuilder::CreateRequest(uint32_t configId)
 {
     auto& configuration = GetConfiguration(configId);
-    auto profiler = RequestProfiler::Create(configuration.GetProfilerConfiguration());
-    profiler->Measure(Gna2InstrumentationPointLibPreprocessing);
-
-    return std::make_unique<Request>(configuration, std::move(profiler));
+    auto request = configuration.AcquireRequest();
+    request->Prepare();
+    return request;
 }
 
 uint32_t RequestBuilder::AssignProfilerConfigId()
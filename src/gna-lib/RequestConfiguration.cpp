@@ -13,14 +13,58 @@
 #include "KernelArguments.h"
 #include "Layer.h"
 #include "LayerConfiguration.h"
+#include "Request.h"
 
 #include "gna-api-status.h"
 
+#include <algorithm>
 #include <memory>
 #include <utility>
 
 using namespace GNA;
 
+using AddressRanges = std::vector<std::pair<uintptr_t, uintptr_t>>;
+
+static void sortAndMerge(AddressRanges & ranges)
+{
+    std::sort(ranges.begin(), ranges.end());
+    size_t mergedCount = 0;
+    for (auto const & range : ranges)
+    {
+        if (mergedCount > 0 && range.first <= ranges[mergedCount - 1].second)
+        {
+            ranges[mergedCount - 1].second = (std::max)(ranges[mergedCount - 1].second, range.second);
+        }
+        else
+        {
+            ranges[mergedCount++] = range;
+        }
+    }
+    ranges.resize(mergedCount);
+}
+
+static bool hasOverlap(AddressRanges const & left, AddressRanges const & right)
+{
+    auto l = left.cbegin();
+    auto r = right.cbegin();
+    while (l != left.cend() && r != right.cend())
+    {
+        if (l->second <= r->first)
+        {
+            ++l;
+        }
+        else if (r->second <= l->first)
+        {
+            ++r;
+        }
+        else
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
 RequestConfiguration::RequestConfiguration(CompiledModel& model, uint32_t configId,
     DeviceVersion consistentDeviceIn) :
     Model{ model },
@@ -28,6 +72,30 @@ RequestConfiguration::RequestConfiguration(CompiledModel& model, uint32_t config
     BufferElementCount{ HardwareCapabilities::GetHardwareConsistencySettings(consistentDeviceIn) },
     consistentDevice{ consistentDeviceIn }
 {
+    updateExecutionPlan();
+    updateBufferRanges();
+}
+
+RequestConfiguration::~RequestConfiguration() = default;
+
+std::unique_ptr<Request> RequestConfiguration::AcquireRequest()
+{
+    {
+        std::lock_guard<std::mutex> lock(requestPoolLock);
+        if (!requestPool.empty())
+        {
+            auto request = std::move(requestPool.back());
+            requestPool.pop_back();
+            return request;
+        }
+    }
+    return std::make_unique<Request>(*this);
+}
+
+void RequestConfiguration::ReleaseRequest(std::unique_ptr<Request> request)
+{
+    std::lock_guard<std::mutex> lock(requestPoolLock);
+    requestPool.emplace_back(std::move(request));
 }
 
 void RequestConfiguration::AddBuffer(uint32_t operandIndex, uint32_t layerIndex, void *address)
@@ -44,6 +112,7 @@ void RequestConfiguration::AddBuffer(uint32_t operandIndex, uint32_t layerIndex,
         addBufferForSingleLayer(context);
 
     }
+    updateBufferRanges();
     Model.InvalidateHardwareRequestConfig(Id);
 }
 
@@ -106,9 +175,96 @@ LayerConfiguration & RequestConfiguration::getLayerConfiguration(uint32_t layerI
 {
     auto const found = LayerConfigurations.emplace(layerIndex, std::make_unique<LayerConfiguration>());
     auto & layerConfiguration = *found.first->second;
+    if (found.second)
+    {
+        auto const stepsEnd = executionPlan.Steps.begin() + executionPlan.LayerFirstStep.at(layerIndex + 1);
+        for (auto step = executionPlan.Steps.begin() + executionPlan.LayerFirstStep.at(layerIndex);
+            step < stepsEnd; ++step)
+        {
+            step->Configuration = &layerConfiguration;
+        }
+    }
     return layerConfiguration;
 }
 
+void RequestConfiguration::updateExecutionPlan()
+{
+    auto const has3_0Consistency = HardwareCapabilities::Is3_0Device(consistentDevice)
+        && Acceleration.GetHwConsistency();
+    auto const & layers = Model.GetLayers();
+
+    executionPlan.Steps.clear();
+    executionPlan.LayerFirstStep.clear();
+    executionPlan.LayerFirstStep.reserve(layers.size() + 1);
+
+    uint32_t layerIndex = 0;
+    for (auto const & layer : layers)
+    {
+        executionPlan.LayerFirstStep.push_back(static_cast<uint32_t>(executionPlan.Steps.size()));
+
+        auto const found = LayerConfigurations.find(layerIndex);
+        auto const configuration = (LayerConfigurations.end() != found) ? found->second.get() : nullptr;
+        auto const is3_0Fix = has3_0Consistency && layer->Is1BInputAnd2BWeight();
+
+        if (layer->IsComputedByTransforms())
+        {
+            for (auto const & transform : layer->Transforms)
+            {
+                if (transform)
+                {
+                    executionPlan.Steps.push_back({ transform.get(), layer.get(), configuration, is3_0Fix });
+                }
+            }
+        }
+        else
+        {
+            executionPlan.Steps.push_back({ nullptr, layer.get(), configuration, is3_0Fix });
+        }
+        ++layerIndex;
+    }
+    executionPlan.LayerFirstStep.push_back(static_cast<uint32_t>(executionPlan.Steps.size()));
+}
+
+bool RequestConfiguration::IsIndependentOf(RequestConfiguration const & other) const
+{
+    return !hasOverlap(writtenRanges, other.accessedRanges)
+        && !hasOverlap(other.writtenRanges, accessedRanges);
+}
+
+void RequestConfiguration::updateBufferRanges()
+{
+    writtenRanges.clear();
+    accessedRanges.clear();
+
+    uint32_t layerIndex = 0;
+    for (auto const & layer : Model.GetLayers())
+    {
+        auto const found = LayerConfigurations.find(layerIndex++);
+        auto const addRange = [&](uint32_t operandIndex, Tensor const & operand, AddressRanges & ranges)
+        {
+            auto address = operand.Buffer.Get<uint8_t>();
+            if (LayerConfigurations.end() != found)
+            {
+                auto const buffer = found->second->Buffers.find(operandIndex);
+                if (found->second->Buffers.end() != buffer)
+                {
+                    address = buffer->second.Get<uint8_t>();
+                }
+            }
+            if (nullptr != address)
+            {
+                auto const begin = reinterpret_cast<uintptr_t>(address);
+                ranges.emplace_back(begin, begin + operand.Size);
+            }
+        };
+        addRange(InputOperandIndex, layer->Input, accessedRanges);
+        addRange(OutputOperandIndex, layer->Output, writtenRanges);
+    }
+    accessedRanges.insert(accessedRanges.end(), writtenRanges.begin(), writtenRanges.end());
+    sortAndMerge(writtenRanges);
+    sortAndMerge(accessedRanges);
+}
+
 void RequestConfiguration::AddActiveList(uint32_t layerIndex, const ActiveList& activeList)
 {
     const auto& layer = Model.GetLayer(layerIndex);
@@ -141,6 +297,7 @@ void RequestConfiguration::SetHardwareConsistency(
     }
     Acceleration.SetHwConsistency(Gna2DeviceVersionSoftwareEmulation != consistentDeviceIn);
     consistentDevice = consistentDeviceIn;
+    updateExecutionPlan();
 }
 
 void RequestConfiguration::EnforceAcceleration(Gna2AccelerationMode accelMode)
@@ -152,6 +309,24 @@ void RequestConfiguration::EnforceAcceleration(Gna2AccelerationMode accelMode)
     Acceleration.SetMode(accelMode);
 }
 
+void RequestConfiguration::SetPriority(Gna2RequestPriority priorityIn)
+{
+    Expect::InRange(priorityIn, Gna2RequestPriorityLow, Gna2RequestPriorityRealTime,
+        Gna2StatusDeviceParameterOutOfRange);
+    Priority = priorityIn;
+}
+
+void RequestConfiguration::SetCompletionEvent(int eventFd)
+{
+#if defined(_WIN32)
+    UNREFERENCED_PARAMETER(eventFd);
+    throw GnaException(Gna2StatusNotImplemented);
+#else // linux
+    Expect::True(eventFd >= -1, Gna2StatusIdentifierInvalid);
+    CompletionEventFd = eventFd;
+#endif
+}
+
 DeviceVersion RequestConfiguration::GetConsistentDevice() const
 {
     return consistentDevice;
@@ -18,17 +18,53 @@
 
 #include <map>
 #include <memory>
+#include <mutex>
 #include <cstdint>
+#include <utility>
+#include <vector>
 
 namespace GNA
 {
 
+class BaseTransform;
+
 class CompiledModel;
 
+class Layer;
+
 class Memory;
 
+class Request;
+
+class ThreadPool;
+
 struct ActiveList;
 
+// Single step of software inference, computing either one layer transform
+// or whole layer using its own compute functions when Transform is NULL
+struct ExecutionStep
+{
+    BaseTransform const * Transform;
+
+    Layer const * SoftwareLayer;
+
+    // NULL when layer has no request specific configuration
+    LayerConfiguration * Configuration;
+
+    // 3.0 consistency config is used for layer
+    bool Is3_0Fix;
+};
+
+// Steps of all model layers flattened in execution order,
+// kept in sync with layer configurations and consistency of request
+struct ExecutionPlan
+{
+    std::vector<ExecutionStep> Steps;
+
+    // Index of first step per layer, with extra index past the last step
+    std::vector<uint32_t> LayerFirstStep;
+};
+
 /*
 ** RequestConfiguration is a bunch of request buffers
 ** sent to GNA kernel driver as part of WRITE request
@@ -39,7 +75,13 @@ class RequestConfiguration
 public:
     RequestConfiguration(CompiledModel& model, uint32_t configId, DeviceVersion consistentDeviceIn);
 
-    ~RequestConfiguration() = default;
+    ~RequestConfiguration();
+
+    // Returns request from pool, allocated only when all pooled requests are in use
+    std::unique_ptr<Request> AcquireRequest();
+
+    // Returns retrieved request to pool
+    void ReleaseRequest(std::unique_ptr<Request> request);
 
     void AddBuffer(uint32_t operandIndex, uint32_t layerIndex, void *address);
 
@@ -49,6 +91,10 @@ public:
 
     void EnforceAcceleration(Gna2AccelerationMode accelMode);
 
+    void SetPriority(Gna2RequestPriority priorityIn);
+
+    void SetCompletionEvent(int eventFd);
+
     bool HasConsistencyMode() const
     {
         return Acceleration.GetHwConsistency();
@@ -72,6 +118,14 @@ public:
         return allocations;
     }
 
+    ExecutionPlan const & GetExecutionPlan() const
+    {
+        return executionPlan;
+    }
+
+    // True when inference of neither configuration writes buffers accessed by the other one
+    bool IsIndependentOf(RequestConfiguration const & other) const;
+
     CompiledModel & Model;
 
     const uint32_t Id;
@@ -87,7 +141,25 @@ public:
 
     AccelerationMode Acceleration = Gna2AccelerationModeAuto;
 
+    // Device thread pool used for splitting layers or NULL when parallel execution is disabled
+    ThreadPool * ParallelWorkers = nullptr;
+
+    Gna2RequestPriority Priority = Gna2RequestPriorityNormal;
+
+    // Deadline of requests relative to enqueuing or 0 when requests have no deadline
+    uint32_t DeadlineMicroseconds = 0;
+
+    // Invoked after request is completed or NULL
+    Gna2RequestCompletionCallback CompletionCallback = nullptr;
+    void * CompletionCallbackData = nullptr;
+
+    // Linux eventfd signaled after request is completed or -1
+    int CompletionEventFd = -1;
+
 private:
+    std::mutex requestPoolLock;
+    std::vector<std::unique_ptr<Request>> requestPool;
+
     struct AddBufferContext
     {
         AddBufferContext(CompiledModel & model, uint32_t operandIndex, uint32_t layerIndex, void *address);
@@ -110,11 +182,23 @@ private:
 
     LayerConfiguration & getLayerConfiguration(uint32_t layerIndex);
 
+    void updateExecutionPlan();
+
+    // Collects ranges of layer inputs and outputs effective for request
+    void updateBufferRanges();
+
     ProfilerConfiguration* profilerConfiguration = nullptr;
 
     DeviceVersion consistentDevice;
 
     MemoryContainer allocations;
+
+    ExecutionPlan executionPlan;
+
+    // Sorted and merged address ranges [begin, end) of layer outputs and of all layer inputs and outputs
+    using BufferRanges = std::vector<std::pair<uintptr_t, uintptr_t>>;
+    BufferRanges writtenRanges;
+    BufferRanges accessedRanges;
 };
 
 }
@@ -9,13 +9,16 @@
 #include "RequestHandler.h"
 #include "RequestConfiguration.h"
 
+#include <algorithm>
 #include <chrono>
-#include <future>
+#include <thread>
 #include <utility>
 
 using namespace GNA;
 
-RequestHandler::RequestHandler(uint32_t threadCount) : threadPool(threadCount)
+RequestHandler::RequestHandler(uint32_t threadCount) :
+    requests(GNA_REQUEST_QUEUE_LENGTH),
+    threadPool(threadCount)
 {}
 
 RequestHandler::~RequestHandler()
@@ -33,6 +36,28 @@ void RequestHandler::ChangeNumberOfThreads(uint32_t threadCount)
     threadPool.SetNumberOfThreads(threadCount);
 }
 
+void RequestHandler::SetRequestBatching(uint32_t maxBatchSize, uint32_t maxWaitMicroseconds)
+{
+    threadPool.SetRequestBatching(maxBatchSize, maxWaitMicroseconds);
+}
+
+void RequestHandler::SetThreadAffinity(std::vector<uint32_t> const & cpus)
+{
+    threadPool.SetAffinity(cpus);
+}
+
+void RequestHandler::SetQueueCapacity(uint32_t capacityIn, uint32_t enqueueTimeoutMilliseconds)
+{
+    Expect::InRange(capacityIn, 1U, GNA_REQUEST_QUEUE_LENGTH_MAX, Gna2StatusDeviceParameterOutOfRange);
+
+    {
+        std::lock_guard<std::mutex> lockGuard(lock);
+        capacity = capacityIn;
+        enqueueTimeout = enqueueTimeoutMilliseconds;
+    }
+    completion.notify_all();
+}
+
 void RequestHandler::Enqueue(
     uint32_t *requestId,
     std::unique_ptr<Request> request)
@@ -40,15 +65,17 @@ void RequestHandler::Enqueue(
     Expect::NotNull(requestId);
     auto r = request.get();
     {
-        std::lock_guard<std::mutex> lockGuard(lock);
+        std::unique_lock<std::mutex> lockGuard(lock);
 
-        if (requests.size() >= GNA_REQUEST_QUEUE_LENGTH)
+        if (!completion.wait_for(lockGuard, std::chrono::milliseconds(enqueueTimeout),
+            [&]() { return uncompletedCount < capacity; }))
         {
             throw GnaException(Gna2StatusDeviceQueueError);
         }
 
         *requestId = assignRequestId();
         r->Id = *requestId;
+        r->Handler = this;
         addRequest(std::move(request));
     }
     r->Profiler->Measure(Gna2InstrumentationPointLibSubmission);
@@ -58,23 +85,116 @@ void RequestHandler::Enqueue(
 
 void RequestHandler::addRequest(std::unique_ptr<Request> request)
 {
-    auto insert = requests.emplace(request->Id, move(request));
-    if (!insert.second)
+    if (pendingCount == requests.size())
+    {
+        growSlots();
+    }
+    auto const slotCount = static_cast<uint32_t>(requests.size());
+    for (uint32_t i = 0; i < slotCount; i++)
+    {
+        auto & slot = requests[(request->Id + i) & (slotCount - 1)];
+        if (!slot)
+        {
+            slot = std::move(request);
+            pendingCount++;
+            uncompletedCount++;
+            return;
+        }
+    }
+    throw GnaException(Gna2StatusResourceAllocationError);
+}
+
+void RequestHandler::growSlots()
+{
+    std::vector<std::unique_ptr<Request>> grown(requests.size() * 2);
+    auto const slotCount = static_cast<uint32_t>(grown.size());
+    for (auto & request : requests)
     {
-        throw GnaException(Gna2StatusResourceAllocationError);
+        auto slot = request->Id & (slotCount - 1);
+        while (grown[slot])
+        {
+            slot = (slot + 1) & (slotCount - 1);
+        }
+        grown[slot] = std::move(request);
     }
+    requests.swap(grown);
 }
 
 Gna2Status RequestHandler::WaitFor(const uint32_t requestId, const uint32_t milliseconds)
 {
-    auto request = extractRequestLocked(requestId);
+    std::unique_ptr<Request> request;
+    {
+        std::unique_lock<std::mutex> lockGuard(lock);
+        Expect::True(hasRequest(requestId), Gna2StatusIdentifierInvalid);
+        completion.wait_for(lockGuard, std::chrono::milliseconds(milliseconds),
+            [&]() { return isCompleted(requestId) || !hasRequest(requestId); });
+        // completion is signaled right after request is completed, thus waited for regardless of timeout
+        completion.wait(lockGuard, [&]() { return !isSignaledByOtherThread(requestId); });
+        Expect::True(hasRequest(requestId), Gna2StatusIdentifierInvalid);
+        request = extractCompleted(requestId);
+    }
+    if (!request)
+    {
+        return Gna2StatusWarningDeviceBusy;
+    }
+    return retrieve(std::move(request));
+}
 
-    auto const status = request->WaitFor(milliseconds);
-    if (Gna2StatusWarningDeviceBusy == status)
+Gna2Status RequestHandler::WaitForAny(uint32_t requestCount, uint32_t const * requestIds, uint32_t milliseconds,
+    uint32_t & completedCount, uint32_t * completedIds, Gna2Status * completedStatuses)
+{
+    completedCount = 0;
+    std::unique_lock<std::mutex> lockGuard(lock);
+    for (uint32_t i = 0; i < requestCount; i++)
     {
-        addRequestLocked(std::move(request));
+        Expect::True(hasRequest(requestIds[i]), Gna2StatusIdentifierInvalid);
     }
-    return status;
+    completion.wait_for(lockGuard, std::chrono::milliseconds(milliseconds),
+        [&]() { return std::any_of(requestIds, requestIds + requestCount,
+            [this](uint32_t requestId) { return isCompleted(requestId); }); });
+    completion.wait(lockGuard,
+        [&]() { return std::none_of(requestIds, requestIds + requestCount,
+            [this](uint32_t requestId) { return isSignaledByOtherThread(requestId); }); });
+    // retrieved under lock, so that no temporary list of completed requests is needed
+    for (uint32_t i = 0; i < requestCount; i++)
+    {
+        auto request = extractCompleted(requestIds[i]);
+        if (request)
+        {
+            completedIds[completedCount] = requestIds[i];
+            completedStatuses[completedCount] = retrieve(std::move(request));
+            completedCount++;
+        }
+    }
+    return completedCount > 0 ? Gna2StatusSuccess : Gna2StatusWarningDeviceBusy;
+}
+
+void RequestHandler::Complete(Request & request, Gna2Status status, bool signaled)
+{
+    {
+        std::lock_guard<std::mutex> lockGuard(lock);
+        request.Status = status;
+        request.Completed = true;
+        uncompletedCount--;
+        if (signaled)
+        {
+            request.SignalingThread = std::this_thread::get_id();
+        }
+    }
+    completion.notify_all();
+}
+
+void RequestHandler::CompletionSignaled(uint32_t requestId)
+{
+    {
+        std::lock_guard<std::mutex> lockGuard(lock);
+        auto const slot = findSlot(requestId);
+        if (slot < requests.size())
+        {
+            requests[slot]->SignalingThread = std::thread::id();
+        }
+    }
+    completion.notify_all();
 }
 
 void RequestHandler::StopRequests()
@@ -84,26 +204,86 @@ void RequestHandler::StopRequests()
 
 bool RequestHandler::HasRequest(uint32_t requestId) const
 {
-    return requests.count(requestId) > 0;
+    std::lock_guard<std::mutex> lockGuard(lock);
+    return hasRequest(requestId);
 }
 
-std::unique_ptr<Request> RequestHandler::extractRequestLocked(const uint32_t requestId)
+uint32_t RequestHandler::findSlot(const uint32_t requestId) const
 {
-    std::lock_guard<std::mutex> lockGuard(lock);
-    auto found = requests.find(requestId);
-    if(found == requests.end())
+    auto const slotCount = static_cast<uint32_t>(requests.size());
+    for (uint32_t i = 0; i < slotCount; i++)
     {
-        throw GnaException(Gna2StatusIdentifierInvalid);
+        auto const slot = (requestId + i) & (slotCount - 1);
+        if (!requests[slot])
+        {
+            break;
+        }
+        if (requests[slot]->Id == requestId)
+        {
+            return slot;
+        }
     }
-    auto extracted = std::move(found->second);
-    requests.erase(found);
-    return extracted;
+    return slotCount;
 }
 
-void RequestHandler::addRequestLocked(std::unique_ptr<Request> request)
+bool RequestHandler::hasRequest(const uint32_t requestId) const
 {
-    std::lock_guard<std::mutex> lockGuard(lock);
-    addRequest(std::move(request));
+    return findSlot(requestId) < requests.size();
+}
+
+std::unique_ptr<Request> RequestHandler::extractCompleted(const uint32_t requestId)
+{
+    auto const slot = findSlot(requestId);
+    if (slot == requests.size() || !requests[slot]->Completed || isSignaledByOtherThread(*requests[slot]))
+    {
+        return nullptr;
+    }
+    pendingCount--;
+    return removeFromSlot(slot);
+}
+
+std::unique_ptr<Request> RequestHandler::removeFromSlot(const uint32_t slot)
+{
+    auto removed = std::move(requests[slot]);
+    auto const mask = static_cast<uint32_t>(requests.size()) - 1;
+    auto freed = slot;
+    for (auto next = (slot + 1) & mask; requests[next]; next = (next + 1) & mask)
+    {
+        // request is moved only when freed slot lies between its home slot and its current one
+        auto const home = requests[next]->Id & mask;
+        if (((next - home) & mask) >= ((next - freed) & mask))
+        {
+            requests[freed] = std::move(requests[next]);
+            freed = next;
+        }
+    }
+    return removed;
+}
+
+bool RequestHandler::isCompleted(const uint32_t requestId) const
+{
+    auto const slot = findSlot(requestId);
+    return slot < requests.size() && requests[slot]->Completed;
+}
+
+bool RequestHandler::isSignaledByOtherThread(const uint32_t requestId) const
+{
+    auto const slot = findSlot(requestId);
+    return slot < requests.size() && requests[slot]->Completed && isSignaledByOtherThread(*requests[slot]);
+}
+
+bool RequestHandler::isSignaledByOtherThread(Request const & request)
+{
+    return std::thread::id() != request.SignalingThread
+        && std::this_thread::get_id() != request.SignalingThread;
+}
+
+Gna2Status RequestHandler::retrieve(std::unique_ptr<Request> request)
+{
+    auto const status = request->Retrieve();
+    auto & configuration = request->Configuration;
+    configuration.ReleaseRequest(std::move(request));
+    return status;
 }
 
 uint32_t RequestHandler::assignRequestId()
@@ -116,4 +296,6 @@ void RequestHandler::clearRequestMap()
 {
     std::lock_guard<std::mutex> lockGuard(lock);
     requests.clear();
+    pendingCount = 0;
+    uncompletedCount = 0;
 }
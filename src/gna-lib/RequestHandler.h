@@ -10,11 +10,12 @@
 
 #include "gna-api.h"
 
+#include <condition_variable>
 #include <cstdint>
 #include <memory>
 #include <mutex>
 #include <stdexcept>
-#include <unordered_map>
+#include <vector>
 
 namespace GNA
 {
@@ -32,28 +33,77 @@ public:
 
     void ChangeNumberOfThreads(uint32_t threadCount);
 
+    void SetRequestBatching(uint32_t maxBatchSize, uint32_t maxWaitMicroseconds);
+
+    void SetThreadAffinity(std::vector<uint32_t> const & cpus);
+
+    // Sets maximal number of requests in progress, enqueue waits up to timeout for free place
+    void SetQueueCapacity(uint32_t capacityIn, uint32_t enqueueTimeoutMilliseconds);
+
     void Enqueue(
         uint32_t *requestId,
         std::unique_ptr<Request> request);
 
     Gna2Status WaitFor(const uint32_t requestId, const uint32_t milliseconds);
 
+    // Waits until any of requests is completed, retrieves all completed ones
+    Gna2Status WaitForAny(uint32_t requestCount, uint32_t const * requestIds, uint32_t milliseconds,
+        uint32_t & completedCount, uint32_t * completedIds, Gna2Status * completedStatuses);
+
+    // Marks request as completed with status and wakes up waiting threads,
+    // when completion is signaled, only calling thread can retrieve request until CompletionSignaled()
+    void Complete(Request & request, Gna2Status status, bool signaled);
+
+    // Makes completed request retrievable by any thread, request may already be retrieved by signaling thread
+    void CompletionSignaled(uint32_t requestId);
+
     void StopRequests();
 
     bool HasRequest(uint32_t requestId) const;
 
+    ThreadPool & GetThreadPool()
+    {
+        return threadPool;
+    }
+
 private:
 
     void clearRequestMap();
 
-    std::unique_ptr<Request> extractRequestLocked(uint32_t requestId);
-    void addRequestLocked(std::unique_ptr<Request> request);
+    // following require lock
+    // returns index of slot holding request or number of slots when request is not pending
+    uint32_t findSlot(uint32_t requestId) const;
+    bool hasRequest(uint32_t requestId) const;
+    // returns request removed from its slot when it is completed and can be retrieved by calling thread or NULL
+    std::unique_ptr<Request> extractCompleted(uint32_t requestId);
+    // removes request from slot, following requests of its probe sequence are shifted back to fill the gap
+    std::unique_ptr<Request> removeFromSlot(uint32_t slot);
+    bool isCompleted(uint32_t requestId) const;
+    // true when request is completed and its completion is being signaled by other thread
+    bool isSignaledByOtherThread(uint32_t requestId) const;
+    static bool isSignaledByOtherThread(Request const & request);
     void addRequest(std::unique_ptr<Request> request);
+    // doubles number of slots, so completed requests not yet retrieved never limit enqueuing
+    void growSlots();
+
+    // saves results of completed request and returns it to pool of its configuration
+    static Gna2Status retrieve(std::unique_ptr<Request> request);
 
     static uint32_t assignRequestId();
 
-    std::unordered_map<uint32_t, std::unique_ptr<Request>> requests;
-    std::mutex lock;
+    // pending requests, request is placed in first free slot starting from its id masked by slot count,
+    // so that enqueuing allocates nothing unless slots are grown
+    // number of slots is power of 2, probe sequences have no gaps, so that lookup stops at first free slot
+    std::vector<std::unique_ptr<Request>> requests;
+    // requests in slots, both in progress and completed but not retrieved yet
+    uint32_t pendingCount = 0;
+    // requests in progress, limited by capacity
+    uint32_t uncompletedCount = 0;
+    uint32_t capacity = GNA_REQUEST_QUEUE_LENGTH;
+    uint32_t enqueueTimeout = 0;
+    mutable std::mutex lock;
+    // shared by all waiting threads and enqueuing threads, notified when any request is completed
+    std::condition_variable completion;
     ThreadPool threadPool;
 };
 
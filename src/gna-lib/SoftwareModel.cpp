@@ -5,6 +5,7 @@
 
 #include "SoftwareModel.h"
 
+#include "AffineFunctions.h"
 #include "Expect.h"
 #include "HardwareCapabilities.h"
 #include "KernelArguments.h"
@@ -19,7 +20,9 @@
 #include <cstdint>
 #include <functional>
 #include <map>
+#include <memory>
 #include <utility>
+#include <vector>
 
 using namespace GNA;
 
@@ -98,30 +101,103 @@ uint32_t SoftwareModel::Score(
     LogAcceleration(accel);
 
     fvBuffers->ReallocateCnnScratchPad(maximumOperandSizes.at(SoftwareScratchpadOperandIndex));
-    auto config = InferenceConfig{ fvBuffers, requestConfiguration };
-    auto layerIter = layers.cbegin() + layerIndex;
-    auto const layerEnd = layerIter + layerCountIn;
+    InferenceConfig config{ fvBuffers, requestConfiguration };
+    auto const & plan = requestConfiguration.GetExecutionPlan();
+    auto step = plan.Steps.data() + plan.LayerFirstStep.at(layerIndex);
+    auto const stepEnd = plan.Steps.data() + plan.LayerFirstStep.at(layerIndex + layerCountIn);
 
     profiler->Measure(Gna2InstrumentationPointLibExecution);
 
-    for (; layerIter < layerEnd; ++layerIter)
+    computeSteps(step, stepEnd, accel, config);
+
+    return config.SaturationCount;
+}
+
+void SoftwareModel::ScoreBatch(
+    RequestConfiguration * const * configurations,
+    RequestProfiler * const * profilers,
+    uint32_t count,
+    KernelBuffers *fvBuffers,
+    uint32_t * saturationCounts)
+{
+    // all requests of batch share acceleration
+    const auto accel = configurations[0]->Acceleration.GetEffectiveSoftwareAccelerationMode(supportedCpuAccelerations);
+    LogAcceleration(accel);
+
+    fvBuffers->ReallocateCnnScratchPad(maximumOperandSizes.at(SoftwareScratchpadOperandIndex));
+
+    std::vector<std::unique_ptr<InferenceConfig>> configs;
+    configs.reserve(count);
+    for (uint32_t i = 0; i < count; i++)
+    {
+        validateConfiguration(*configurations[i]);
+        configs.emplace_back(std::make_unique<InferenceConfig>(fvBuffers, *configurations[i]));
+        profilers[i]->Measure(Gna2InstrumentationPointLibExecution);
+    }
+
+    LayerBatch batch{ count, {}, {} };
+    for (uint32_t layerIndex = 0; layerIndex < layerCount; layerIndex++)
     {
-        auto const & layer = *layerIter;
-        auto const found = requestConfiguration.LayerConfigurations.find(layerIndex);
-        if (found == requestConfiguration.LayerConfigurations.end())
+        auto const & layer = *layers[layerIndex];
+        if (layer.ComputeBatch)
         {
-            layer->ComputeHidden(accel, config.GetEffective(*layer));
+            for (uint32_t i = 0; i < count; i++)
+            {
+                auto const & plan = configurations[i]->GetExecutionPlan();
+                auto const & step = plan.Steps.at(plan.LayerFirstStep.at(layerIndex));
+                batch.Configurations[i] = step.Configuration;
+                batch.Executions[i] = &configs[i]->GetEffective(step.Is3_0Fix);
+            }
+            if (layer.ComputeBatch(batch, accel))
+            {
+                continue;
+            }
         }
-        else
+        for (uint32_t i = 0; i < count; i++)
         {
-            auto const layerConfiguration = found->second.get();
-            layer->Compute(*layerConfiguration, accel, config.GetEffective(*layer));
+            auto const & plan = configurations[i]->GetExecutionPlan();
+            computeSteps(plan.Steps.data() + plan.LayerFirstStep.at(layerIndex),
+                plan.Steps.data() + plan.LayerFirstStep.at(layerIndex + 1), accel, *configs[i]);
         }
+    }
 
-        ++layerIndex;
+    for (uint32_t i = 0; i < count; i++)
+    {
+        saturationCounts[i] = configs[i]->SaturationCount;
     }
+}
 
-    return config.SaturationCount;
+void SoftwareModel::PackWeights()
+{
+    for (auto const & layer : layers)
+    {
+        auto const affine = layer->Transforms.Get<AffineFunctionSingle>(AffineTransform);
+        if (nullptr != affine)
+        {
+            affine->PackWeights();
+        }
+    }
+}
+
+void SoftwareModel::computeSteps(ExecutionStep const * step, ExecutionStep const * stepEnd,
+    AccelerationMode accel, InferenceConfig const & config)
+{
+    for (; step < stepEnd; ++step)
+    {
+        auto const & execution = config.GetEffective(step->Is3_0Fix);
+        if (nullptr != step->Transform)
+        {
+            step->Transform->Compute(accel, step->Configuration, execution);
+        }
+        else if (nullptr != step->Configuration)
+        {
+            step->SoftwareLayer->Compute(*step->Configuration, accel, execution);
+        }
+        else
+        {
+            step->SoftwareLayer->ComputeHidden(accel, execution);
+        }
+    }
 }
 
 void SoftwareModel::validateConfiguration(const RequestConfiguration& configuration) const
@@ -157,35 +233,10 @@ Layer const& SoftwareModel::GetLayer(uint32_t layerIndex) const
 
 InferenceConfig::InferenceConfig(KernelBuffers* fvBuffers,
     RequestConfiguration const& requestConfiguration) :
-    SaturationCount{ 0 }
-{
-    executionConfig = std::make_unique<ExecutionConfig>(fvBuffers,
-        &SaturationCount, requestConfiguration.BufferElementCount);
-    auto const is3_0 = HardwareCapabilities::Is3_0Device(requestConfiguration.GetConsistentDevice());
-    has3_0Consistency = is3_0 && requestConfiguration.Acceleration.GetHwConsistency();
-    if (has3_0Consistency)
-    {
-        executionConfig3_0 = std::make_unique<ExecutionConfig>(fvBuffers,
-            &SaturationCount, requestConfiguration.BufferElementCountFor3_0);
-        getEffective = &InferenceConfig::getFor3_0Fix;
-    }
-    else
-    {
-        getEffective = &InferenceConfig::getNormal;
-    }
-}
-
-ExecutionConfig& InferenceConfig::getFor3_0Fix(Layer const & layer) const
-{
-    if (layer.Is1BInputAnd2BWeight())
-    {
-        return *executionConfig3_0;
-    }
-    return *executionConfig;
-}
-
-ExecutionConfig& InferenceConfig::getNormal(Layer const & layer) const
+    SaturationCount{ 0 },
+    executionConfig{ fvBuffers, &SaturationCount,
+        requestConfiguration.BufferElementCount, requestConfiguration.ParallelWorkers },
+    executionConfig3_0{ fvBuffers, &SaturationCount,
+        requestConfiguration.BufferElementCountFor3_0, requestConfiguration.ParallelWorkers }
 {
-    UNREFERENCED_PARAMETER(layer);
-    return *executionConfig;
 }
@@ -23,6 +23,8 @@ namespace GNA
 class BaseValidator;
 class RequestConfiguration;
 class RequestProfiler;
+struct ExecutionStep;
+struct InferenceConfig;
 
 class SoftwareModel : public IScorable
 {
@@ -59,8 +61,22 @@ public:
         RequestProfiler *profiler,
         KernelBuffers *fvBuffers) override;
 
+    /**
+     * Scores count requests layer by layer, computing layers that support batches
+     * for all requests at once, and stores saturation count of each request.
+     */
+    void ScoreBatch(
+        RequestConfiguration * const * configurations,
+        RequestProfiler * const * profilers,
+        uint32_t count,
+        KernelBuffers *fvBuffers,
+        uint32_t * saturationCounts);
+
     void validateConfiguration(const RequestConfiguration& configuration) const;
 
+    // Repacks weights of layers supporting packed kernels, see AffineFunctionSingle::PackWeights()
+    void PackWeights();
+
     uint32_t GetMaximumOperandSize(uint32_t operandIndex);
 
     Layer const& GetLayer(uint32_t layerIndex) const;
@@ -102,6 +118,10 @@ private:
 
     void buildSingleLayer(std::unique_ptr<Layer> & layer);
 
+    // Computes steps of request plan from step up to stepEnd
+    static void computeSteps(ExecutionStep const * step, ExecutionStep const * stepEnd,
+        AccelerationMode accel, InferenceConfig const & config);
+
     void CheckModel(uint32_t declaredBatchSize, void * operationPointer) const;
 
     uint32_t FindMaximumOperandSize(uint32_t operandIndex) const;
@@ -120,31 +140,25 @@ private:
 
 struct InferenceConfig
 {
-    typedef ExecutionConfig& (InferenceConfig::*GetEffectiveMethod)(Layer const & layer) const;
-
     InferenceConfig(KernelBuffers *fvBuffers, RequestConfiguration const &requestConfiguration);
 
-    ExecutionConfig& GetEffective(Layer& layer) const
+    InferenceConfig(const InferenceConfig &) = delete;
+    InferenceConfig& operator=(const InferenceConfig&) = delete;
+
+    ExecutionConfig const & GetEffective(bool is3_0Fix) const
     {
-        return (this->*getEffective)(layer);
+        return is3_0Fix ? executionConfig3_0 : executionConfig;
     }
 
     // scoring saturation counter
     uint32_t SaturationCount;
 
 private:
-    GetEffectiveMethod getEffective;
-
-    ExecutionConfig& getNormal(Layer const & layer) const;
-    ExecutionConfig& getFor3_0Fix(Layer const & layer) const;
-
-    // if 3.0 consistency is active
-    bool has3_0Consistency = false;
-
     // config for usual inference request
-    std::unique_ptr<ExecutionConfig> executionConfig;
+    ExecutionConfig const executionConfig;
 
-    std::unique_ptr<ExecutionConfig> executionConfig3_0;
+    // config for layers with 1B input and 2B weight when 3.0 consistency is active
+    ExecutionConfig const executionConfig3_0;
 };
 
 }
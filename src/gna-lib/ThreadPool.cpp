@@ -12,12 +12,22 @@
 #include "KernelArguments.h"
 
 #include "common.h"
+#include "gna-api.h"
 #include "gna-api-status.h"
 #include "gna-api-types-xnn.h"
 
+#include <algorithm>
+#include <chrono>
 #include <cstring>
 #include <cstdint>
 
+#if defined(_WIN32)
+#include <windows.h>
+#else // linux
+#include <pthread.h>
+#include <sched.h>
+#endif
+
 using namespace GNA;
 
 // will set memory only in DEBUG configuration
@@ -32,6 +42,29 @@ static void clearMemoryInDebug(M* memory, S size)
 #endif
 }
 
+// restricts calling thread to run only on given CPU
+static void pinCurrentThread(uint32_t cpu)
+{
+#if defined(_WIN32)
+    auto const mask = DWORD_PTR{ 1 } << cpu;
+    Expect::True(0 != SetThreadAffinityMask(GetCurrentThread(), mask), Gna2StatusDeviceParameterOutOfRange);
+#else // linux
+    cpu_set_t cpus;
+    CPU_ZERO(&cpus);
+    CPU_SET(cpu, &cpus);
+    Expect::Zero(pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus), Gna2StatusDeviceParameterOutOfRange);
+#endif
+}
+
+static uint32_t getCpuCountMax()
+{
+#if defined(_WIN32)
+    return sizeof(DWORD_PTR) * 8;
+#else // linux
+    return CPU_SETSIZE;
+#endif
+}
+
 KernelBuffers::KernelBuffers()
 {
     auto const size = 8 * (UINT16_MAX + 1) * sizeof(int16_t);
@@ -76,6 +109,10 @@ KernelBuffers::~KernelBuffers()
     {
         _gna_free(cnnFusedBuffer);
     }
+    if (nullptr != blockBuffer)
+    {
+        _gna_free(blockBuffer);
+    }
     memset(this, 0, sizeof(*this));
 }
 
@@ -100,6 +137,27 @@ void KernelBuffers::ReallocateCnnScratchPad(uint32_t cnnScratchSize)
     }
 }
 
+void KernelBuffers::ReallocateBlockBuffer(uint32_t blockSize)
+{
+    if (blockSize > blockBufferSize)
+    {
+        if (nullptr != blockBuffer)
+        {
+            _gna_free(blockBuffer);
+            blockBuffer = nullptr;
+            blockBufferSize = 0;
+        }
+        blockBuffer = static_cast<int8_t*>(_kernel_malloc(blockSize));
+        if (nullptr == blockBuffer)
+        {
+            throw GnaException(Gna2StatusResourceAllocationError);
+        }
+        blockBufferSize = blockSize;
+
+        clearMemoryInDebug(blockBuffer, blockSize);
+    }
+}
+
 ThreadPool::ThreadPool(uint32_t threadCount) :
     buffers{ threadCount },
     numberOfThreads{ threadCount }
@@ -127,6 +185,7 @@ void ThreadPool::SetNumberOfThreads(uint32_t threadCount)
         return;
     }
 
+    // requests not yet taken stay queued for new workers
     StopAndJoin();
 
     try
@@ -143,13 +202,58 @@ void ThreadPool::SetNumberOfThreads(uint32_t threadCount)
     employWorkers();
 }
 
+void ThreadPool::SetRequestBatching(uint32_t maxBatchSizeIn, uint32_t maxWaitMicroseconds)
+{
+    Expect::InRange(maxBatchSizeIn, ui32_1, XNN_N_GROUP_MAX, Gna2StatusDeviceParameterOutOfRange);
 
+    maxBatchSize = maxBatchSizeIn;
+    maxBatchWait = maxWaitMicroseconds;
+}
+
+void ThreadPool::SetAffinity(std::vector<uint32_t> const & cpus)
+{
+    for (auto const cpu : cpus)
+    {
+        Expect::InRange(cpu, getCpuCountMax() - 1, Gna2StatusDeviceParameterOutOfRange);
+    }
+    auto pinned = cpus;
+
+    StopAndJoin();
+    std::swap(affinity, pinned);
+    try
+    {
+        employWorkers();
+    }
+    catch (...)
+    {
+        // e.g. CPU not available to process, previous affinity is restored
+        std::swap(affinity, pinned);
+        employWorkers();
+        throw;
+    }
+}
 
 void ThreadPool::Enqueue(Request *request)
 {
-    std::lock_guard<std::mutex> lock(tpMutex);
-    tasks.emplace_back(request);
-    condition.notify_one();
+    {
+        std::lock_guard<std::mutex> lock(requestsMutex);
+        if (request->IsScheduled())
+        {
+            schedule.push({ request, scheduleSequence++ });
+        }
+        else
+        {
+            requests.push_back(request);
+        }
+        queuedRequests++;
+    }
+
+    if (sleepingWorkers > 0)
+    {
+        std::lock_guard<std::mutex> lock(tpMutex);
+        // worker woken up may not start request while other one executes requests
+        condition.notify_all();
+    }
 }
 
 void ThreadPool::StopAndJoin()
@@ -168,28 +272,268 @@ void ThreadPool::StopAndJoin()
     workers.clear();
 }
 
-void ThreadPool::employWorkers()
+void ThreadPool::ParallelFor(uint32_t partCount, KernelBuffers * callerBuffers, PartWork const & work)
 {
-    stopped = false;
-    for (uint32_t i = 0; i < numberOfThreads; i++)
+    ParallelJob job{ partCount, work };
+    if (partCount > 1 && numberOfThreads > 1)
+    {
+        std::lock_guard<std::mutex> lock(tpMutex);
+        jobs.emplace_back(&job);
+        queuedJobs++;
+        condition.notify_all();
+    }
+
+    try
+    {
+        executeParts(job, callerBuffers);
+    }
+    catch (...)
+    {
+        std::lock_guard<std::mutex> lock(tpMutex);
+        job.Error = std::current_exception();
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(tpMutex);
+        auto const queued = std::find(jobs.begin(), jobs.end(), &job);
+        if (queued != jobs.end())
+        {
+            jobs.erase(queued);
+            queuedJobs--;
+        }
+        jobCompleted.wait(lock, [&]() { return 0 == job.ActiveWorkers; });
+    }
+
+    if (job.Error)
+    {
+        std::rethrow_exception(job.Error);
+    }
+}
+
+void ThreadPool::executeParts(ParallelJob & job, KernelBuffers * partBuffers)
+{
+    for (auto part = job.NextPart++; part < job.PartCount; part = job.NextPart++)
+    {
+        job.Work(part, partBuffers);
+    }
+}
+
+void ThreadPool::helpWithJob(std::unique_lock<std::mutex> & lock, KernelBuffers * workerBuffers)
+{
+    auto & job = *jobs.front();
+    if (job.NextPart >= job.PartCount)
+    {
+        // all parts claimed, remaining ones are finished by their owners
+        jobs.pop_front();
+        queuedJobs--;
+        return;
+    }
+
+    job.ActiveWorkers++;
+    lock.unlock();
+    try
+    {
+        executeParts(job, workerBuffers);
+    }
+    catch (...)
+    {
+        lock.lock();
+        job.Error = std::current_exception();
+        lock.unlock();
+    }
+    lock.lock();
+    if (0 == --job.ActiveWorkers)
+    {
+        jobCompleted.notify_all();
+    }
+}
+
+bool ThreadPool::ScheduledLater::operator()(ScheduledRequest const & first, ScheduledRequest const & second) const
+{
+    if (first.Item->Priority != second.Item->Priority)
+    {
+        return first.Item->Priority < second.Item->Priority;
+    }
+    if (first.Item->Deadline != second.Item->Deadline)
+    {
+        return first.Item->Deadline > second.Item->Deadline;
+    }
+    return first.Sequence > second.Sequence;
+}
+
+bool ThreadPool::takeScheduled(Gna2RequestPriority minPriority, Request *& request)
+{
+    if (schedule.empty() || schedule.top().Item->Priority < minPriority)
+    {
+        return false;
+    }
+    request = schedule.top().Item;
+    schedule.pop();
+    return true;
+}
+
+bool ThreadPool::tryTakeRequest(Request *& request)
+{
+    if (0 == queuedRequests)
+    {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(requestsMutex);
+    // queue holds requests of normal priority without deadline,
+    // thus scheduled ones of normal priority with deadline precede them
+    if (!takeScheduled(Gna2RequestPriorityNormal, request))
+    {
+        if (!requests.empty())
+        {
+            request = requests.front();
+            requests.pop_front();
+        }
+        else if (!takeScheduled(Gna2RequestPriorityLow, request))
+        {
+            return false;
+        }
+    }
+    queuedRequests--;
+    return true;
+}
+
+Request * ThreadPool::scoreBatch(Request * first, KernelBuffers * workerBuffers)
+{
+    Request * batch[XNN_N_GROUP_MAX] = { first };
+    uint32_t count = 1;
+    Request * rejected = nullptr;
+
+    auto const batchSize = maxBatchSize.load();
+    auto const deadline = std::chrono::steady_clock::now() + std::chrono::microseconds(maxBatchWait.load());
+    while (count < batchSize)
+    {
+        Request * request;
+        if (tryTakeRequest(request))
+        {
+            auto const canBeBatched = request->IsBatchable() && std::all_of(batch, batch + count,
+                [request](Request const * batched) { return batched->CanBeBatchedWith(*request); });
+            if (!canBeBatched)
+            {
+                rejected = request;
+                break;
+            }
+            batch[count++] = request;
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(tpMutex);
+        sleepingWorkers++;
+        auto const hasRequest = condition.wait_until(lock, deadline,
+            [&]() { return stopped || queuedRequests > 0; });
+        sleepingWorkers--;
+        if (!hasRequest || stopped)
+        {
+            break;
+        }
+    }
+
+    Request::ScoreBatch(batch, count, workerBuffers);
+    return rejected;
+}
+
+void ThreadPool::work(uint32_t workerIndex)
+{
+    try
     {
-        KernelBuffers* buff = &buffers.at(i);
-        this->workers.emplace_back([&, buff]() {
-            while (true)
+        if (!affinity.empty())
+        {
+            pinCurrentThread(affinity[workerIndex % affinity.size()]);
+        }
+        // allocated after pinning, so that memory is first touched on worker's NUMA node
+        buffers.at(workerIndex).reset();
+        buffers.at(workerIndex) = std::make_unique<KernelBuffers>();
+    }
+    catch (...)
+    {
+        std::lock_guard<std::mutex> lock(tpMutex);
+        if (!startError)
+        {
+            startError = std::current_exception();
+        }
+        startedWorkers++;
+        workerStarted.notify_one();
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(tpMutex);
+        startedWorkers++;
+        workerStarted.notify_one();
+    }
+
+    auto const workerBuffers = buffers.at(workerIndex).get();
+    while (!stopped)
+    {
+        // parts of requests already in progress take precedence over new requests
+        if (queuedJobs > 0)
+        {
+            std::unique_lock<std::mutex> lock(tpMutex);
+            if (!jobs.empty())
+            {
+                helpWithJob(lock, workerBuffers);
+            }
+            continue;
+        }
+
+        Request * request;
+        if (!executingRequests.exchange(true))
+        {
+            auto const hasRequest = tryTakeRequest(request);
+            // request rejected by batch starts next batch, so that every request taken is scored
+            while (hasRequest && nullptr != request)
             {
-                std::unique_lock<std::mutex> lock(tpMutex);
-                condition.wait(lock, [&]() { return stopped || !tasks.empty(); });
-                if (stopped)
+                if (maxBatchSize > 1 && request->IsBatchable())
                 {
-                    return;
+                    request = scoreBatch(request, workerBuffers);
                 }
-                if (!tasks.empty())
+                else
                 {
-                    auto request_task = tasks.front();
-                    tasks.pop_front();
-                    request_task->operator()(buff);
+                    request->operator()(workerBuffers);
+                    request = nullptr;
                 }
             }
+            executingRequests = false;
+            if (hasRequest)
+            {
+                continue;
+            }
+        }
+
+        // worker releasing execution checks queued requests itself, thus no wakeup is missed
+        std::unique_lock<std::mutex> lock(tpMutex);
+        sleepingWorkers++;
+        condition.wait(lock, [&]()
+        {
+            return stopped || !jobs.empty() || (queuedRequests > 0 && !executingRequests);
         });
+        sleepingWorkers--;
+    }
+}
+
+void ThreadPool::employWorkers()
+{
+    stopped = false;
+    startedWorkers = 0;
+    startError = nullptr;
+    for (uint32_t i = 0; i < numberOfThreads; i++)
+    {
+        this->workers.emplace_back([this, i]() { work(i); });
+    }
+
+    std::exception_ptr error;
+    {
+        std::unique_lock<std::mutex> lock(tpMutex);
+        workerStarted.wait(lock, [&]() { return numberOfThreads == startedWorkers; });
+        error = startError;
+    }
+    if (error)
+    {
+        StopAndJoin();
+        std::rethrow_exception(error);
     }
 }
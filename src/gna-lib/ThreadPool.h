@@ -7,10 +7,17 @@
 
 #include "KernelArguments.h"
 
+#include "gna2-inference-api.h"
+
+#include <atomic>
 #include <condition_variable>
 #include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
 #include <mutex>
 #include <deque>
+#include <queue>
 #include <thread>
 #include <vector>
 
@@ -18,8 +25,18 @@ namespace GNA
 {
 class Request;
 
+/**
+ * Executes requests on worker threads
+ * Requests are taken in order of enqueuing, requests with non-default priority or deadline
+ * are kept in schedule instead, taken by strict priority and earliest deadline first within priority.
+ * When batching is enabled, worker coalesces pending requests of the same model into one batch.
+ * Requests are executed one at a time, as they share per model state (e.g. kernel configurations
+ * and layer scratchpads), while idle workers help with parts of request in progress.
+ */
 class ThreadPool {
 public:
+    using PartWork = std::function<void(uint32_t partIndex, KernelBuffers * buffers)>;
+
     explicit ThreadPool(uint32_t threadCount);
     ~ThreadPool();
     ThreadPool(const ThreadPool &) = delete;
@@ -30,19 +47,111 @@ public:
     void SetNumberOfThreads(uint32_t threadCount);
 
     void Enqueue(Request *request);
+
+    /**
+     * Enables coalescing up to maxBatchSize requests into single batched inference,
+     * worker waits up to maxWaitMicroseconds for requests to fill the batch.
+     * Batching is disabled with maxBatchSize equal to 1.
+     */
+    void SetRequestBatching(uint32_t maxBatchSize, uint32_t maxWaitMicroseconds);
+
+    /**
+     * Pins worker i to CPU cpus[i % cpus.size()], workers are not pinned when cpus is empty.
+     * Workers are restarted and allocate own buffers after pinning,
+     * so that on NUMA systems buffers are placed in memory local to worker's CPU.
+     */
+    void SetAffinity(std::vector<uint32_t> const & cpus);
+
     void StopAndJoin();
 
+    /**
+     * Executes work for each of partCount parts using calling thread and idle workers,
+     * returns when all parts are completed.
+     * Calling thread uses callerBuffers, workers use own buffers.
+     */
+    void ParallelFor(uint32_t partCount, KernelBuffers * callerBuffers, PartWork const & work);
+
 private:
+    struct ParallelJob
+    {
+        ParallelJob(uint32_t partCountIn, PartWork const & workIn) :
+            PartCount{ partCountIn },
+            Work{ workIn }
+        {}
+
+        uint32_t const PartCount;
+        PartWork const & Work;
+        std::atomic<uint32_t> NextPart{ 0 };
+        // number of workers executing job parts, guarded by tpMutex
+        uint32_t ActiveWorkers = 0;
+        std::exception_ptr Error;
+    };
+
+    struct ScheduledRequest
+    {
+        Request * Item;
+        // order of enqueuing, keeps requests of equal priority and deadline in FIFO order
+        uint64_t Sequence;
+    };
+
+    // true when first request is scheduled after second one
+    struct ScheduledLater
+    {
+        bool operator()(ScheduledRequest const & first, ScheduledRequest const & second) const;
+    };
+
+    // starts workers and waits until all of them are pinned and have buffers allocated
     void employWorkers();
 
+    // worker loop
+    void work(uint32_t workerIndex);
+
+    // takes request from schedule or queue
+    bool tryTakeRequest(Request *& request);
+
+    // takes first scheduled request when its priority is at least minPriority, requires requestsMutex
+    bool takeScheduled(Gna2RequestPriority minPriority, Request *& request);
+
+    // scores first request together with pending requests that can be batched with it,
+    // returns first request taken that cannot be batched or NULL
+    Request * scoreBatch(Request * first, KernelBuffers * workerBuffers);
+
+    // executes parts not yet claimed by other threads
+    static void executeParts(ParallelJob & job, KernelBuffers * partBuffers);
+
+    void helpWithJob(std::unique_lock<std::mutex> & lock, KernelBuffers * workerBuffers);
+
     // NOTE: order is important, buffers have to be destroyed last
-    std::vector<KernelBuffers> buffers;
+    // allocated by workers, each worker accesses only own element
+    std::vector<std::unique_ptr<KernelBuffers>> buffers;
+    // number of requests queued or scheduled and not yet taken by workers
+    std::atomic<uint32_t> queuedRequests{ 0 };
+    std::atomic<uint32_t> sleepingWorkers{ 0 };
+    std::atomic<bool> stopped{ false };
+    // set by worker executing requests, other workers only help with its parallel jobs
+    std::atomic<bool> executingRequests{ false };
+
+    // guards requests and schedule
+    std::mutex requestsMutex;
+    std::deque<Request*> requests;
+    std::priority_queue<ScheduledRequest, std::vector<ScheduledRequest>, ScheduledLater> schedule;
+    uint64_t scheduleSequence = 0;
+
+    std::atomic<uint32_t> maxBatchSize{ 1 };
+    std::atomic<uint32_t> maxBatchWait{ 0 };
+    // guards jobs and worker sleeping
     std::mutex tpMutex;
-    std::deque<Request*> tasks;
-    bool stopped = false;
+    std::deque<ParallelJob*> jobs;
+    std::atomic<uint32_t> queuedJobs{ 0 };
     std::condition_variable condition;
+    std::condition_variable jobCompleted;
+    // number of workers started and first worker startup error, guarded by tpMutex
+    uint32_t startedWorkers = 0;
+    std::exception_ptr startError;
+    std::condition_variable workerStarted;
     std::vector<std::thread> workers;
     uint32_t numberOfThreads;
+    std::vector<uint32_t> affinity;
 };
 
 }
@@ -144,10 +144,10 @@ public:
         ExecutionConfig const & execution) const override
     {
         auto executionConfig = createExecutionConfig(layerConfiguration, execution);
-        updateExecutionKernelConfig(*executionConfig);
+        updateExecutionKernelConfig(executionConfig);
         try
         {
-            kernels->at(accel)(executionConfig.get());
+            kernels.at(accel)(&executionConfig);
         }
         catch (const std::out_of_range&)
         {
@@ -179,7 +179,7 @@ public:
 protected:
     Transform(TransformOperation operation, const KernelMap<KernelType>* kernelsIn, Tensor const * input) :
         BaseTransform{ operation, input },
-        kernels{ kernelsIn }
+        kernels{ *kernelsIn }
     {};
     Transform(const Transform&) = delete;
     Transform(const Transform&&) = delete;
@@ -196,23 +196,23 @@ protected:
         return static_cast<KernelConfig<TransformType>*>(config.get());
     }
 
-    const KernelMap<KernelType>* kernels;
+    const KernelTable<KernelType> kernels;
 
     std::unique_ptr<KernelConfig<TransformType>> hiddenConfig;
 
-    inline std::unique_ptr<ExecutionKernelConfig<TransformType>> createExecutionConfig(
+    // execution config is created on stack, inference does no heap allocations
+    inline ExecutionKernelConfig<TransformType> createExecutionConfig(
         const LayerConfiguration* layerConfiguration, ExecutionConfig const & execution) const
     {
         if (nullptr == layerConfiguration)
         {
-            return std::make_unique<ExecutionKernelConfig<TransformType>>(
-                hiddenConfig.get(), execution);
+            return ExecutionKernelConfig<TransformType>{ hiddenConfig.get(), execution };
         }
         else
         {
-            return std::make_unique<ExecutionKernelConfig<TransformType>>(
+            return ExecutionKernelConfig<TransformType>{
                 static_cast<KernelConfig<TransformType>*>(layerConfiguration->ConfigList[Operation].get()),
-                execution);
+                execution };
         }
     }
 
@@ -255,13 +255,13 @@ public:
         {
             if (layerConfiguration != nullptr && layerConfiguration->ActList)
             {
-                kernelsAl->at(accel)(executionConfig.get(), AffineConfigAl{
+                kernelsAl.at(accel)(&executionConfig, AffineConfigAl{
                                     layerConfiguration->ActList->Indices,
                                     layerConfiguration->ActList->IndicesCount });
             }
             else
             {
-                Transform<TransformType, KernelType>::kernels->at(accel)(executionConfig.get());
+                Transform<TransformType, KernelType>::kernels.at(accel)(&executionConfig);
             }
         }
         catch (const std::out_of_range&)
@@ -276,10 +276,10 @@ protected:
         const KernelMap<KernelTypeAl>* kernelsAlIn,
         Tensor const * input) :
         Transform<TransformType, KernelType>{ operation, kernelsIn, input },
-        kernelsAl{ kernelsAlIn }
+        kernelsAl{ *kernelsAlIn }
     {};
 
-    const KernelMap<KernelTypeAl>* kernelsAl;
+    const KernelTable<KernelTypeAl> kernelsAl;
 };
 
 
@@ -25,11 +25,10 @@ TransposeLayer::TransposeLayer(const nn_layer& layer, const BaseValidator& valid
 
     Expect::Null(Output.ScratchPad); // in transpose layer no 4B output array is allowed
 
-    ComputeHidden = [this](AccelerationMode accel, ExecutionConfig const & executionConfig)
-                    {this->computeHidden(accel, executionConfig); };
-
-    Compute = [this](LayerConfiguration &layerConfiguration, AccelerationMode accel, ExecutionConfig const & executionConfig)
-                    {this->compute(layerConfiguration, accel, executionConfig); };
+    setComputeFunctions([this](AccelerationMode accel, ExecutionConfig const & executionConfig)
+                    {this->computeHidden(accel, executionConfig); },
+        [this](LayerConfiguration &layerConfiguration, AccelerationMode accel, ExecutionConfig const & executionConfig)
+                    {this->compute(layerConfiguration, accel, executionConfig); });
 }
 
 TransposeLayer::TransposeLayer(
@@ -55,11 +54,10 @@ TransposeLayer::TransposeLayer(
 
     Expect::Null(Output.ScratchPad); // in transpose layer no 4B output array is allowed
 
-    ComputeHidden = [this](AccelerationMode accel, ExecutionConfig const & executionConfig)
-                    {this->computeHidden(accel, executionConfig); };
-
-    Compute = [this](LayerConfiguration &layerConfiguration, AccelerationMode accel, ExecutionConfig const & executionConfig)
-                    {this->compute(layerConfiguration, accel, executionConfig); };
+    setComputeFunctions([this](AccelerationMode accel, ExecutionConfig const & executionConfig)
+                    {this->computeHidden(accel, executionConfig); },
+        [this](LayerConfiguration &layerConfiguration, AccelerationMode accel, ExecutionConfig const & executionConfig)
+                    {this->compute(layerConfiguration, accel, executionConfig); });
 }
 
 void TransposeLayer::UpdateKernelConfigs(LayerConfiguration& layerConfiguration) const
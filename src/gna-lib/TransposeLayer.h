@@ -37,7 +37,7 @@ private:
     void computeHidden(AccelerationMode accel, ExecutionConfig const & executionConfig) const;
     void compute(const LayerConfiguration& layerConfiguration, AccelerationMode accel, ExecutionConfig const & executionConfig) const;
 
-    const KernelMap<TransposeKernel>& transposeKernels;
+    const KernelTable<TransposeKernel> transposeKernels;
     std::unique_ptr<TransposeConfig> transposeHiddenConfig;
 };
 
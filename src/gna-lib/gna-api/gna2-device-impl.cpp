@@ -13,6 +13,7 @@
 #include "gna2-common-impl.h"
 
 #include <functional>
+#include <vector>
 
 using namespace GNA;
 
@@ -54,6 +55,65 @@ enum Gna2Status Gna2DeviceSetNumberOfThreads(
     return ApiWrapper::ExecuteSafely(command);
 }
 
+enum Gna2Status Gna2DeviceSetRequestBatching(
+    uint32_t deviceIndex,
+    uint32_t maxBatchSize,
+    uint32_t maxWaitMicroseconds)
+{
+    const std::function<ApiStatus()> command = [&]()
+    {
+        auto& deviceManager = DeviceManager::Get();
+        deviceManager.SetRequestBatching(deviceIndex, maxBatchSize, maxWaitMicroseconds);
+        return Gna2StatusSuccess;
+    };
+    return ApiWrapper::ExecuteSafely(command);
+}
+
+enum Gna2Status Gna2DeviceSetRequestQueueCapacity(
+    uint32_t deviceIndex,
+    uint32_t capacity,
+    uint32_t enqueueTimeoutMilliseconds)
+{
+    const std::function<ApiStatus()> command = [&]()
+    {
+        auto& deviceManager = DeviceManager::Get();
+        deviceManager.SetRequestQueueCapacity(deviceIndex, capacity, enqueueTimeoutMilliseconds);
+        return Gna2StatusSuccess;
+    };
+    return ApiWrapper::ExecuteSafely(command);
+}
+
+enum Gna2Status Gna2DeviceSetThreadAffinity(
+    uint32_t deviceIndex,
+    uint32_t cpuCount,
+    uint32_t const * cpuIndices)
+{
+    const std::function<ApiStatus()> command = [&]()
+    {
+        if (cpuCount > 0)
+        {
+            Expect::NotNull(cpuIndices);
+        }
+        auto& deviceManager = DeviceManager::Get();
+        deviceManager.SetThreadAffinity(deviceIndex, std::vector<uint32_t>(cpuIndices, cpuIndices + cpuCount));
+        return Gna2StatusSuccess;
+    };
+    return ApiWrapper::ExecuteSafely(command);
+}
+
+enum Gna2Status Gna2DeviceSetWeightPacking(
+    uint32_t deviceIndex,
+    uint32_t enabled)
+{
+    const std::function<ApiStatus()> command = [&]()
+    {
+        auto& deviceManager = DeviceManager::Get();
+        deviceManager.SetWeightPacking(deviceIndex, 0 != enabled);
+        return Gna2StatusSuccess;
+    };
+    return ApiWrapper::ExecuteSafely(command);
+}
+
 enum Gna2Status Gna2DeviceOpen(
     uint32_t deviceIndex)
 {
@@ -8,6 +8,7 @@
 #include "ApiWrapper.h"
 #include "Logger.h"
 #include "DeviceManager.h"
+#include "Expect.h"
 #include "Macros.h"
 #include "ModelWrapper.h"
 
@@ -88,6 +89,71 @@ GNA2_API enum Gna2Status Gna2RequestConfigSetAccelerationMode(
     return ApiWrapper::ExecuteSafely(command);
 }
 
+GNA2_API enum Gna2Status Gna2RequestConfigEnableParallelExecution(
+    uint32_t requestConfigId)
+{
+    const std::function<ApiStatus()> command = [&]()
+    {
+        auto& device = DeviceManager::Get().GetDeviceForRequestConfigId(requestConfigId);
+        device.EnableParallelExecution(requestConfigId);
+        return Gna2StatusSuccess;
+    };
+    return ApiWrapper::ExecuteSafely(command);
+}
+
+GNA2_API enum Gna2Status Gna2RequestConfigSetPriority(
+    uint32_t requestConfigId,
+    enum Gna2RequestPriority priority)
+{
+    const std::function<ApiStatus()> command = [&]()
+    {
+        auto& device = DeviceManager::Get().GetDeviceForRequestConfigId(requestConfigId);
+        device.SetRequestPriority(requestConfigId, priority);
+        return Gna2StatusSuccess;
+    };
+    return ApiWrapper::ExecuteSafely(command);
+}
+
+GNA2_API enum Gna2Status Gna2RequestConfigSetDeadline(
+    uint32_t requestConfigId,
+    uint32_t microseconds)
+{
+    const std::function<ApiStatus()> command = [&]()
+    {
+        auto& device = DeviceManager::Get().GetDeviceForRequestConfigId(requestConfigId);
+        device.SetRequestDeadline(requestConfigId, microseconds);
+        return Gna2StatusSuccess;
+    };
+    return ApiWrapper::ExecuteSafely(command);
+}
+
+GNA2_API enum Gna2Status Gna2RequestConfigSetCompletionCallback(
+    uint32_t requestConfigId,
+    Gna2RequestCompletionCallback callback,
+    void * userData)
+{
+    const std::function<ApiStatus()> command = [&]()
+    {
+        auto& device = DeviceManager::Get().GetDeviceForRequestConfigId(requestConfigId);
+        device.SetCompletionCallback(requestConfigId, callback, userData);
+        return Gna2StatusSuccess;
+    };
+    return ApiWrapper::ExecuteSafely(command);
+}
+
+GNA2_API enum Gna2Status Gna2RequestConfigSetCompletionEvent(
+    uint32_t requestConfigId,
+    int eventFd)
+{
+    const std::function<ApiStatus()> command = [&]()
+    {
+        auto& device = DeviceManager::Get().GetDeviceForRequestConfigId(requestConfigId);
+        device.SetCompletionEvent(requestConfigId, eventFd);
+        return Gna2StatusSuccess;
+    };
+    return ApiWrapper::ExecuteSafely(command);
+}
+
 GNA2_API enum Gna2Status Gna2RequestConfigRelease(
     uint32_t requestConfigId)
 {
@@ -125,6 +191,28 @@ GNA2_API enum Gna2Status Gna2RequestWait(
     return ApiWrapper::ExecuteSafely(command);
 }
 
+GNA2_API enum Gna2Status Gna2RequestWaitAny(
+    uint32_t numberOfRequests,
+    uint32_t const * requestIds,
+    uint32_t timeoutMilliseconds,
+    uint32_t * numberOfCompleted,
+    uint32_t * completedRequestIds,
+    enum Gna2Status * completedStatuses)
+{
+    const std::function<ApiStatus()> command = [&]()
+    {
+        Expect::GtZero(numberOfRequests, Gna2StatusIdentifierInvalid);
+        Expect::NotNull(requestIds);
+        Expect::NotNull(numberOfCompleted);
+        Expect::NotNull(completedRequestIds);
+        Expect::NotNull(completedStatuses);
+        auto& device = DeviceManager::Get().GetDeviceForRequestId(requestIds[0]);
+        return device.WaitForAnyRequest(numberOfRequests, requestIds, timeoutMilliseconds,
+            *numberOfCompleted, completedRequestIds, completedStatuses);
+    };
+    return ApiWrapper::ExecuteSafely(command);
+}
+
 AccelerationMode::AccelerationMode(Gna2AccelerationMode basicMode, bool hardwareConsistencyEnabled)
     : hardwareConsistency{ hardwareConsistencyEnabled }
 {
@@ -30,6 +30,17 @@ GNA2_API enum Gna2Status Gna2MemoryAlloc(
     return ApiWrapper::ExecuteSafely(command);
 }
 
+GNA2_API enum Gna2Status Gna2MemorySetHugePages(
+    uint32_t enabled)
+{
+    const std::function<ApiStatus()> command = [&]()
+    {
+        DeviceManager::Get().SetHugePages(0 != enabled);
+        return Gna2StatusSuccess;
+    };
+    return ApiWrapper::ExecuteSafely(command);
+}
+
 GNA2_API enum Gna2Status Gna2MemoryFree(
     void * memory)
 {
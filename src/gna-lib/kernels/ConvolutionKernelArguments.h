@@ -50,9 +50,22 @@ struct ConvolutionConfig2D
         ZeroPaddingHeight{ ZeroPaddingHeightIn },
         BiasMode{ BiasModeIn },
         BiasDataMode{ BiasDataModeIn },
-        BiasData{ BiasDataIn }
+        BiasData{ BiasDataIn },
+        FirstOutputRow{ 0 },
+        OutputRowCount{ 1 + (InputHeightIn + 2 * ZeroPaddingHeightIn - FilterHeightIn) / StrideHeightIn }
     {
     }
+
+    // Creates config computing outputRowCountIn output rows of source starting from firstOutputRowIn,
+    // output buffer holds only computed rows
+    ConvolutionConfig2D(ConvolutionConfig2D const & source, const uint32_t firstOutputRowIn,
+        const uint32_t outputRowCountIn) :
+        ConvolutionConfig2D{ source }
+    {
+        FirstOutputRow = firstOutputRowIn;
+        OutputRowCount = outputRowCountIn;
+    }
+
     const uint32_t InputWidth;
     const uint32_t InputHeight;
     const uint32_t InputDepth;
@@ -74,4 +87,7 @@ struct ConvolutionConfig2D
     const KernelBiasMode BiasMode;
     const KernelDataMode BiasDataMode;
     const void* const BiasData;
+
+    uint32_t FirstOutputRow;
+    uint32_t OutputRowCount;
 };
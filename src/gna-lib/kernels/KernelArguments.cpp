@@ -37,6 +37,21 @@ AffineConfig::AffineConfig(AffineConfig const * const source, ExecutionConfig co
     execution = &executionConfigIn;
 }
 
+AffineConfig::AffineConfig(AffineConfig const & source, uint32_t const firstRow, uint32_t const rowCountIn,
+    void const * weightsIn, void const * biases) :
+    outputElementCount{rowCountIn},
+    inputVectorCount{source.inputVectorCount},
+    inputElementCount{source.inputElementCount},
+    input{source.input},
+    output{nullptr == source.output ? nullptr : source.output + firstRow * source.inputVectorCount},
+    execution{source.execution},
+    weights1B{static_cast<int8_t const *>(weightsIn)},
+    biasesCompound{static_cast<nn_bias_c const *>(biases)},
+    multiBias{source.multiBias},
+    multiBiasVectorCount{source.multiBiasVectorCount},
+    bytesPerBias{source.bytesPerBias}
+{}
+
 AffineConfig::AffineConfig(uint32_t const outputElementCountIn, uint32_t const inputVectorCountIn,
     uint32_t const inputElementCountIn, int16_t const * inputIn, int32_t * const outputIn,
     void const * weightsIn, void const * biases, void const * multiBiasIn,
@@ -44,10 +44,15 @@ struct KernelBuffers
         rhs.d7 = nullptr;
         rhs.pool = nullptr;
         rhs.cnnFusedBuffer = nullptr;
+        rhs.blockBuffer = nullptr;
     }
 
     void ReallocateCnnScratchPad(uint32_t cnnScratchSize);
 
+    // Grows buffer for intermediate results of blocks of rows, also of batched requests,
+    // to at least blockSize bytes
+    void ReallocateBlockBuffer(uint32_t blockSize);
+
     int16_t *d0 = nullptr;
     int16_t *d1 = nullptr;
     int16_t *d2 = nullptr;
@@ -59,11 +64,14 @@ struct KernelBuffers
     int64_t *pool = nullptr;
     int8_t *cnnFusedBuffer = nullptr;
     uint32_t cnnFusedBufferSize = 0;
+    int8_t *blockBuffer = nullptr;
+    uint32_t blockBufferSize = 0;
 };
 
 namespace GNA
 {
 struct PwlCached;
+class ThreadPool;
 }
 
 struct BaseConfig
@@ -110,15 +118,19 @@ struct KernelConfig : public BaseConfig
 struct ExecutionConfig
 {
     ExecutionConfig() = default;
-    ExecutionConfig(KernelBuffers * intermediate, uint32_t * saturationCount, uint32_t const * bufferElementCount) :
+    ExecutionConfig(KernelBuffers * intermediate, uint32_t * saturationCount, uint32_t const * bufferElementCount,
+        GNA::ThreadPool * workers = nullptr) :
         Intermediate{ intermediate },
         SaturationCount{ saturationCount },
-        BufferElementCount{ bufferElementCount }
+        BufferElementCount{ bufferElementCount },
+        Workers{ workers }
     {};
 
     KernelBuffers * const Intermediate;
     uint32_t * const SaturationCount;
     uint32_t const * const BufferElementCount;
+    // Thread pool for splitting layers across threads or NULL for single-threaded execution
+    GNA::ThreadPool * const Workers = nullptr;
 };
 
 template<typename TransformConfig>
@@ -147,6 +159,9 @@ struct AffineConfig
 {
     AffineConfig(int16_t const * inputIn, int32_t * const outputIn, AffineConfig const * const source);
     AffineConfig(AffineConfig const * const source, ExecutionConfig const & executionConfigIn);
+    // Creates config for rowCountIn outputs of source starting from firstRow
+    AffineConfig(AffineConfig const & source, uint32_t const firstRow, uint32_t const rowCountIn,
+        void const * weightsIn, void const * biases);
     AffineConfig(uint32_t const outputElementCountIn, uint32_t const inputVectorCountIn,
         uint32_t const inputElementCountIn, int16_t const * inputIn, int32_t * const outputIn, void const * weightsIn,
         void const * biases, void const * multiBiasIn, uint32_t const multiBiasVectorCountIn);
@@ -177,6 +192,28 @@ struct AffineConfig
     uint32_t const bytesPerBias = 0;
 };
 
+/**
+ * Layout of 2B weights repacked by library for packed affine kernels:
+ * panels of RowCount rows, each stored as consecutive chunks of ElementCount elements of every panel row,
+ * zero padded to whole panels and chunks
+ */
+struct AffinePackedLayout
+{
+    static constexpr uint32_t RowCount = 8;
+    static constexpr uint32_t ElementCount = 16;
+
+    static uint32_t GetChunkCount(uint32_t inputElementCount)
+    {
+        return (inputElementCount + ElementCount - 1) / ElementCount;
+    }
+
+    // Bytes of packed weights per row
+    static uint32_t GetRowSize(uint32_t inputElementCount)
+    {
+        return GetChunkCount(inputElementCount) * ElementCount * static_cast<uint32_t>(sizeof(int16_t));
+    }
+};
+
 struct AffineConfigAl
 {
     AffineConfigAl(uint32_t const * indicesIn, uint32_t const countIn);
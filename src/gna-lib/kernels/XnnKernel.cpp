@@ -27,19 +27,15 @@ namespace GNA
 #define copyKernelImpl KERNEL(copyKernelImpl)
 #define copyKernelImpl1B KERNEL(copyKernelImpl1B)
 #define copyKernelImpl2B KERNEL(copyKernelImpl2B)
-#define InitializeActivationFunctions KERNEL(InitializeActivationFunctions)
-
-#if OPT_LEVEL < 2
+#define GetActivationFunctions KERNEL(GetActivationFunctions)
 #define recurrentKernelImpl1B1B KERNEL(recurrentKernelImpl1B1B)
 #define recurrentKernelImpl1B2B KERNEL(recurrentKernelImpl1B2B)
 #define recurrentKernelImpl2B1B KERNEL(recurrentKernelImpl2B1B)
 #define recurrentKernelImpl2B2B KERNEL(recurrentKernelImpl2B2B)
-#endif
 
 void activationKernelImpl(ExecutionKernelConfig<ActivationConfig> const * const config)
 {
-    config->RequestConfig->Transform.Kernel->InitializeActivationFunctions();
-    config->RequestConfig->Transform.Kernel->ActivateAll(config);
+    config->RequestConfig->Transform.Kernel->GetActivationFunctions().ActivateAll(config);
 }
 
 void recurrentKernelImpl1B(ExecutionKernelConfig<RecurrentConfig> const * const config)
@@ -52,6 +48,7 @@ void recurrentKernelImpl1B(ExecutionKernelConfig<RecurrentConfig> const * const
     io->Inputs = reinterpret_cast<int8_t const *>(runConfig.output);
     io->Outputs = config->RequestConfig->Outputs;
 
+    auto const activateAll = activation.Kernel->GetActivationFunctions().ActivateAll;
     auto feedback = runConfig.feedbackBuffer;
     auto outputs = runConfig.output;
     auto inputs = config->RequestConfig->Inputs;
@@ -68,8 +65,7 @@ void recurrentKernelImpl1B(ExecutionKernelConfig<RecurrentConfig> const * const
         runConfig.feedbackBuffer += outputElementCount;
         runConfig.output += outputElementCount;
 
-        activation.Kernel->InitializeActivationFunctions();
-        activation.Kernel->ActivateAll(&activationCfg);
+        activateAll(&activationCfg);
         io->Inputs = io->Inputs + activation.ElementCount * 4;
         io->Outputs = io->Outputs +
             activation.ElementCount * config->RequestConfig->Transform.bytesPerOutput;
@@ -91,6 +87,7 @@ void recurrentKernelImpl2B(ExecutionKernelConfig<RecurrentConfig> const * const
     io->Inputs = reinterpret_cast<int8_t const *>(runConfig.output);
     io->Outputs = config->RequestConfig->Outputs;
 
+    auto const activateAll = activation.Kernel->GetActivationFunctions().ActivateAll;
     auto feedback = runConfig.feedbackBuffer;
     auto outputs = runConfig.output;
     auto inputs = config->RequestConfig->Inputs;
@@ -107,8 +104,7 @@ void recurrentKernelImpl2B(ExecutionKernelConfig<RecurrentConfig> const * const
         runConfig.feedbackBuffer += outputElementCount;
         runConfig.output += outputElementCount;
 
-        activation.Kernel->InitializeActivationFunctions();
-        activation.Kernel->ActivateAll(&activationCfg);
+        activateAll(&activationCfg);
         io->Inputs = io->Inputs + activation.ElementCount * 4;
         io->Outputs = io->Outputs +
             activation.ElementCount * config->RequestConfig->Transform.bytesPerOutput;
@@ -120,7 +116,6 @@ void recurrentKernelImpl2B(ExecutionKernelConfig<RecurrentConfig> const * const
     config->RequestConfig->Inputs = inputs;
 }
 
-#if OPT_LEVEL < 2
 void recurrentKernelImpl1B1B(ExecutionKernelConfig<RecurrentConfig> const * const config)
 {
     auto& runConfig = config->RequestConfig->Transform;
@@ -131,6 +126,7 @@ void recurrentKernelImpl1B1B(ExecutionKernelConfig<RecurrentConfig> const * cons
     io->Inputs = reinterpret_cast<int8_t const *>(runConfig.output);
     io->Outputs = config->RequestConfig->Outputs;
 
+    auto const activateAll = activation.Kernel->GetActivationFunctions().ActivateAll;
     auto feedback = runConfig.feedbackBuffer;
     auto outputs = runConfig.output;
     auto inputs = config->RequestConfig->Inputs;
@@ -155,8 +151,7 @@ void recurrentKernelImpl1B1B(ExecutionKernelConfig<RecurrentConfig> const * cons
         }
         runConfig.output += outputElementCount;
 
-        activation.Kernel->InitializeActivationFunctions();
-        activation.Kernel->ActivateAll(&activationCfg);
+        activateAll(&activationCfg);
         io->Inputs = io->Inputs + activation.ElementCount * 4;
         io->Outputs = io->Outputs +
             activation.ElementCount * config->RequestConfig->Transform.bytesPerOutput;
@@ -177,6 +172,7 @@ void recurrentKernelImpl1B2B(ExecutionKernelConfig<RecurrentConfig> const * cons
     io->Inputs = reinterpret_cast<int8_t const *>(runConfig.output);
     io->Outputs = config->RequestConfig->Outputs;
 
+    auto const activateAll = activation.Kernel->GetActivationFunctions().ActivateAll;
     auto feedback = runConfig.feedbackBuffer;
     auto outputs = runConfig.output;
     auto inputs = config->RequestConfig->Inputs;
@@ -201,8 +197,7 @@ void recurrentKernelImpl1B2B(ExecutionKernelConfig<RecurrentConfig> const * cons
         }
         runConfig.output += outputElementCount;
 
-        activation.Kernel->InitializeActivationFunctions();
-        activation.Kernel->ActivateAll(&activationCfg);
+        activateAll(&activationCfg);
         io->Inputs = io->Inputs + activation.ElementCount * 4;
         io->Outputs = io->Outputs +
             activation.ElementCount * config->RequestConfig->Transform.bytesPerOutput;
@@ -224,6 +219,7 @@ void recurrentKernelImpl2B1B(ExecutionKernelConfig<RecurrentConfig> const * cons
     io->Inputs = reinterpret_cast<int8_t const *>(runConfig.output);
     io->Outputs = config->RequestConfig->Outputs;
 
+    auto const activateAll = activation.Kernel->GetActivationFunctions().ActivateAll;
     auto feedback = runConfig.feedbackBuffer;
     auto outputs = runConfig.output;
     auto inputs = config->RequestConfig->Inputs;
@@ -248,8 +244,7 @@ void recurrentKernelImpl2B1B(ExecutionKernelConfig<RecurrentConfig> const * cons
         }
         runConfig.output += outputElementCount;
 
-        activation.Kernel->InitializeActivationFunctions();
-        activation.Kernel->ActivateAll(&activationCfg);
+        activateAll(&activationCfg);
         io->Inputs = io->Inputs + activation.ElementCount * 4;
         io->Outputs = io->Outputs +
             activation.ElementCount * config->RequestConfig->Transform.bytesPerOutput;
@@ -271,6 +266,7 @@ void recurrentKernelImpl2B2B(ExecutionKernelConfig<RecurrentConfig> const * cons
     io->Inputs = reinterpret_cast<int8_t const *>(runConfig.output);
     io->Outputs = config->RequestConfig->Outputs;
 
+    auto const activateAll = activation.Kernel->GetActivationFunctions().ActivateAll;
     auto feedback = runConfig.feedbackBuffer;
     auto outputs = runConfig.output;
     auto inputs = config->RequestConfig->Inputs;
@@ -295,8 +291,7 @@ void recurrentKernelImpl2B2B(ExecutionKernelConfig<RecurrentConfig> const * cons
         }
         runConfig.output += outputElementCount;
 
-        activation.Kernel->InitializeActivationFunctions();
-        activation.Kernel->ActivateAll(&activationCfg);
+        activateAll(&activationCfg);
         io->Inputs = io->Inputs + activation.ElementCount * 4;
         io->Outputs = io->Outputs +
             activation.ElementCount * config->RequestConfig->Transform.bytesPerOutput;
@@ -308,7 +303,6 @@ void recurrentKernelImpl2B2B(ExecutionKernelConfig<RecurrentConfig> const * cons
     config->RequestConfig->Inputs = inputs;
 }
 
-#endif
 void copyKernelImpl(CopyConfig const * const config)
 {
     uint32_t row;
@@ -362,8 +356,13 @@ static void CodeCaveMitigationFakeKernel()
 
 XnnKernel KERNEL(xnnKernel) =
 {
+#if OPT_LEVEL == 6
+    AffineBlockedKernelImpl1B,
+    AffineBlockedKernelImpl2B,
+#else
     AffineKernelImpl1B,
     AffineKernelImpl2B,
+#endif
 
     AffineActiveListKernelImpl1B,
     AffineActiveListKernelImpl2B,
@@ -384,36 +383,68 @@ XnnKernel KERNEL(xnnKernel) =
     TransposeKernelImpl,
     copyKernelImpl,
 
-#if OPT_LEVEL < 2
-
     AffineKernelImpl1B1B,
     AffineKernelImpl2B1B,
+#if OPT_LEVEL < 2
     AffineKernelImpl1B2B,
     AffineKernelImpl2B2B,
+#else
+    (AffineKernel)CodeCaveMitigationFakeKernel,
+    (AffineKernel)CodeCaveMitigationFakeKernel,
+#endif
     AffineActiveListKernelImpl1B1B,
     AffineActiveListKernelImpl2B1B,
+#if OPT_LEVEL < 2
     AffineActiveListKernelImpl1B2B,
     AffineActiveListKernelImpl2B2B,
+#else
+    (AffineActiveListKernel)CodeCaveMitigationFakeKernel,
+    (AffineActiveListKernel)CodeCaveMitigationFakeKernel,
+#endif
     AffineMultiBiasKernelImpl1B1B,
     AffineMultiBiasKernelImpl2B1B,
+#if OPT_LEVEL < 2
     AffineMultiBiasKernelImpl1B2B,
     AffineMultiBiasKernelImpl2B2B,
+#else
+    (AffineKernel)CodeCaveMitigationFakeKernel,
+    (AffineKernel)CodeCaveMitigationFakeKernel,
+#endif
     DiagonalKernelImpl1B1B,
     DiagonalKernelImpl2B1B,
+#if OPT_LEVEL < 2
     DiagonalKernelImpl1B2B,
     DiagonalKernelImpl2B2B,
+#else
+    (AffineKernel)CodeCaveMitigationFakeKernel,
+    (AffineKernel)CodeCaveMitigationFakeKernel,
+#endif
     recurrentKernelImpl1B1B,
     recurrentKernelImpl2B1B,
     recurrentKernelImpl1B2B,
     recurrentKernelImpl2B2B,
+#if OPT_LEVEL < 2
     ConvolutionKernelImpl1B,
     ConvolutionPoolingKernelImpl1B,
     ConvolutionKernelImpl2B,
     ConvolutionPoolingKernelImpl2B,
+#else
+    (ConvolutionKernel)CodeCaveMitigationFakeKernel,
+    (ConvolutionPoolingKernel)CodeCaveMitigationFakeKernel,
+    (ConvolutionKernel)CodeCaveMitigationFakeKernel,
+    (ConvolutionPoolingKernel)CodeCaveMitigationFakeKernel,
+#endif
     TransposeKernelImpl1B,
+#if OPT_LEVEL < 2
     TransposeKernelImpl2B,
     copyKernelImpl1B,
     copyKernelImpl2B,
+#else
+    // interleave and deinterleave specializations first, tiled transposition otherwise
+    TransposeKernelImpl,
+    (CopyKernel)CodeCaveMitigationFakeKernel,
+    (CopyKernel)CodeCaveMitigationFakeKernel,
+#endif
 
     Convolution2DKernelImpl1B1B,
     Convolution2DKernelImpl1B2B,
@@ -422,43 +453,12 @@ XnnKernel KERNEL(xnnKernel) =
 
     Pooling2DKernelImpl1B,
     Pooling2DKernelImpl2B,
-    Pooling2DKernelImpl4B
+    Pooling2DKernelImpl4B,
+
+#if GNA_SAT
+    nullptr
 #else
-    (AffineKernel)CodeCaveMitigationFakeKernel,
-    (AffineKernel)CodeCaveMitigationFakeKernel,
-    (AffineKernel)CodeCaveMitigationFakeKernel,
-    (AffineKernel)CodeCaveMitigationFakeKernel,
-    (AffineActiveListKernel)CodeCaveMitigationFakeKernel,
-    (AffineActiveListKernel)CodeCaveMitigationFakeKernel,
-    (AffineActiveListKernel)CodeCaveMitigationFakeKernel,
-    (AffineActiveListKernel)CodeCaveMitigationFakeKernel,
-    (AffineKernel)CodeCaveMitigationFakeKernel,
-    (AffineKernel)CodeCaveMitigationFakeKernel,
-    (AffineKernel)CodeCaveMitigationFakeKernel,
-    (AffineKernel)CodeCaveMitigationFakeKernel,
-    (AffineKernel)CodeCaveMitigationFakeKernel,
-    (AffineKernel)CodeCaveMitigationFakeKernel,
-    (AffineKernel)CodeCaveMitigationFakeKernel,
-    (AffineKernel)CodeCaveMitigationFakeKernel,
-    (RecurrentKernel)CodeCaveMitigationFakeKernel,
-    (RecurrentKernel)CodeCaveMitigationFakeKernel,
-    (RecurrentKernel)CodeCaveMitigationFakeKernel,
-    (RecurrentKernel)CodeCaveMitigationFakeKernel,
-    (ConvolutionKernel)CodeCaveMitigationFakeKernel,
-    (ConvolutionPoolingKernel)CodeCaveMitigationFakeKernel,
-    (ConvolutionKernel)CodeCaveMitigationFakeKernel,
-    (ConvolutionPoolingKernel)CodeCaveMitigationFakeKernel,
-    (TransposeKernel)CodeCaveMitigationFakeKernel,
-    (TransposeKernel)CodeCaveMitigationFakeKernel,
-    (CopyKernel)CodeCaveMitigationFakeKernel,
-    (CopyKernel)CodeCaveMitigationFakeKernel,
-    (ConvolutionKernel2D)CodeCaveMitigationFakeKernel,
-    (ConvolutionKernel2D)CodeCaveMitigationFakeKernel,
-    (ConvolutionKernel2D)CodeCaveMitigationFakeKernel,
-    (ConvolutionKernel2D)CodeCaveMitigationFakeKernel,
-    (PoolingKernel2D)CodeCaveMitigationFakeKernel,
-    (PoolingKernel2D)CodeCaveMitigationFakeKernel,
-    (PoolingKernel2D)CodeCaveMitigationFakeKernel
+    AffinePackedKernelImpl2B
 #endif
 };
 
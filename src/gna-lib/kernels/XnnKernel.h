@@ -12,7 +12,10 @@
 
 #include "../gna-api/gna2-inference-impl.h"
 
+#include <array>
+#include <cstddef>
 #include <map>
+#include <stdexcept>
 
 struct ActivationConfig;
 struct AffineConfig;
@@ -33,6 +36,48 @@ struct PwlCached;
 template<typename KernelType>
 using KernelMap = std::map<AccelerationMode, KernelType>;
 
+/**
+ * Kernels of KernelMap resolved once into flat table indexed by acceleration mode,
+ * so that selecting kernel during inference needs no map lookup
+ */
+template<typename KernelType>
+class KernelTable
+{
+public:
+    KernelTable(KernelMap<KernelType> const & kernelMap)
+    {
+        kernels.fill(nullptr);
+        for (auto const & kernel : kernelMap)
+        {
+            kernels.at(getIndex(kernel.first)) = kernel.second;
+        }
+    }
+
+    // throws std::out_of_range when there is no kernel for accel, as KernelMap does
+    KernelType at(AccelerationMode const & accel) const
+    {
+        auto const kernel = kernels.at(getIndex(accel));
+        if (nullptr == kernel)
+        {
+            throw std::out_of_range("No kernel for acceleration mode");
+        }
+        return kernel;
+    }
+
+    bool Has(AccelerationMode const & accel) const
+    {
+        return nullptr != kernels.at(getIndex(accel));
+    }
+
+private:
+    static size_t getIndex(AccelerationMode const & accel)
+    {
+        return static_cast<size_t>(accel.GetMode()) * 2 + (accel.GetHwConsistency() ? 1 : 0);
+    }
+
+    std::array<KernelType, (Gna2AccelerationModeGeneric + 1) * 2> kernels;
+};
+
 typedef void (*VoidKernel)();
 
 typedef void (*AffineKernel)(ExecutionKernelConfig<AffineConfig> const * const config);
@@ -122,6 +167,8 @@ typedef struct _XnnKernel
     PoolingKernel2D convolutionPooling2D1B;
     PoolingKernel2D convolutionPooling2D2B;
     PoolingKernel2D convolutionPooling2D4B;
+
+    AffineKernel affineSingle2Bpacked;
 } XnnKernel;
 
 // Export list of available Xnn kernels providers
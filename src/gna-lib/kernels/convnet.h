@@ -42,13 +42,6 @@ extern "C" {
     void ConvolutionPoolingKernelImpl(ConvolutionConfig const * const filterConfig,
         PoolingConfig const * const poolConfig, PwlCached const * const pwl);
 
-#if OPT_LEVEL < 2
-    void ConvolutionKernelImpl1B(ConvolutionConfig const * const filterConfig);
-    void ConvolutionKernelImpl2B(ConvolutionConfig const * const filterConfig);
-    void ConvolutionPoolingKernelImpl1B(ConvolutionConfig const * const filterConfig,
-        PoolingConfig const * const poolConfig, PwlCached const * const pwl);
-    void ConvolutionPoolingKernelImpl2B(ConvolutionConfig const * const filterConfig,
-        PoolingConfig const * const poolConfig, PwlCached const * const pwl);
     void Convolution2DKernelImpl1B1B(ExecutionKernelConfig<ConvolutionConfig2D> const * const config);
     void Convolution2DKernelImpl1B2B(ExecutionKernelConfig<ConvolutionConfig2D> const * const config);
     void Convolution2DKernelImpl2B1B(ExecutionKernelConfig<ConvolutionConfig2D> const * const config);
@@ -56,6 +49,14 @@ extern "C" {
     void Pooling2DKernelImpl1B(ExecutionKernelConfig<PoolingConfig2D> const * const config);
     void Pooling2DKernelImpl2B(ExecutionKernelConfig<PoolingConfig2D> const * const config);
     void Pooling2DKernelImpl4B(ExecutionKernelConfig<PoolingConfig2D> const * const config);
+
+#if OPT_LEVEL < 2
+    void ConvolutionKernelImpl1B(ConvolutionConfig const * const filterConfig);
+    void ConvolutionKernelImpl2B(ConvolutionConfig const * const filterConfig);
+    void ConvolutionPoolingKernelImpl1B(ConvolutionConfig const * const filterConfig,
+        PoolingConfig const * const poolConfig, PwlCached const * const pwl);
+    void ConvolutionPoolingKernelImpl2B(ConvolutionConfig const * const filterConfig,
+        PoolingConfig const * const poolConfig, PwlCached const * const pwl);
 #endif
 /* Calculates MaxPartialPoolingFunction
 * @PS   number of pool size
@@ -0,0 +1,629 @@
+/**
+ @copyright (C) 2021 Intel Corporation
+ SPDX-License-Identifier: LGPL-2.1-or-later
+ */
+
+// 2D convolution and pooling kernels for SSE4, AVX1 and AVX2.
+// Inputs and outputs are in NHWC order, so for each output position and filter row
+// valid (not padded) filter columns and input depth form one contiguous segment
+// in both input and filter, which is computed as a single madd based dot product.
+// Convolution results match generic kernels, which accumulate in 64 bits and
+// truncate (fast) or saturate (sat) the result to 32 bits.
+// Pooling is vectorized across channels, which are contiguous for every window element.
+
+#include "convnet.h"
+#include "igemv.h"
+
+#include "ConvolutionKernelArguments.h"
+#include "KernelArguments.h"
+#include "KernelMacros.h"
+#include "PoolingKernelArguments.h"
+
+#include "common.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <immintrin.h>
+#include <limits>
+#include <type_traits>
+
+namespace
+{
+
+#if OPT_LEVEL > 5
+constexpr uint32_t VEC_CAP = 16;
+
+__forceinline mm_vector load16(int8_t const * const data)
+{
+    return _mm256_cvtepi8_epi16(_mm_loadu_si128((__m128i const *)data));
+}
+
+__forceinline mm_vector load16(int16_t const * const data)
+{
+    return _mm256_loadu_si256((__m256i const *)data);
+}
+
+__forceinline mm_vector madd(mm_vector const a, mm_vector const b)
+{
+    return _mm256_madd_epi16(a, b);
+}
+
+__forceinline mm_vector add32(mm_vector const a, mm_vector const b)
+{
+    return _mm256_add_epi32(a, b);
+}
+
+__forceinline int32_t horizontalSum32(mm_vector const acc)
+{
+    __m128i s = _mm_add_epi32(_mm256_castsi256_si128(acc), _mm256_extracti128_si256(acc, 1));
+    s = _mm_hadd_epi32(s, s);
+    s = _mm_hadd_epi32(s, s);
+    return _mm_cvtsi128_si32(s);
+}
+
+// Adds 32-bit elements of x to 64-bit accumulator,
+// when isMaddOverflow is set INT32_MIN elements are treated as 2^31
+__forceinline mm_vector add64(mm_vector const acc, mm_vector const x, bool const isMaddOverflow)
+{
+    auto lo = _mm256_cvtepi32_epi64(_mm256_castsi256_si128(x));
+    auto hi = _mm256_cvtepi32_epi64(_mm256_extracti128_si256(x, 1));
+    if (isMaddOverflow)
+    {
+        auto const overflow = _mm256_cmpeq_epi32(x, _mm256_set1_epi32(INT32_MIN));
+        auto const correction = _mm256_set1_epi64x(INT64_C(1) << 32);
+        lo = _mm256_add_epi64(lo, _mm256_and_si256(
+            _mm256_cvtepi32_epi64(_mm256_castsi256_si128(overflow)), correction));
+        hi = _mm256_add_epi64(hi, _mm256_and_si256(
+            _mm256_cvtepi32_epi64(_mm256_extracti128_si256(overflow, 1)), correction));
+    }
+    return _mm256_add_epi64(acc, _mm256_add_epi64(lo, hi));
+}
+
+__forceinline int64_t horizontalSum64(mm_vector const acc)
+{
+    __m128i s = _mm_add_epi64(_mm256_castsi256_si128(acc), _mm256_extracti128_si256(acc, 1));
+    return _mm_extract_epi64(s, 0) + _mm_extract_epi64(s, 1);
+}
+#else // SSE4 & AVX1
+constexpr uint32_t VEC_CAP = 8;
+
+__forceinline mm_vector load16(int8_t const * const data)
+{
+    return _mm_cvtepi8_epi16(_mm_loadl_epi64((__m128i const *)data));
+}
+
+__forceinline mm_vector load16(int16_t const * const data)
+{
+    return _mm_loadu_si128((__m128i const *)data);
+}
+
+__forceinline mm_vector madd(mm_vector const a, mm_vector const b)
+{
+    return _mm_madd_epi16(a, b);
+}
+
+__forceinline mm_vector add32(mm_vector const a, mm_vector const b)
+{
+    return _mm_add_epi32(a, b);
+}
+
+__forceinline int32_t horizontalSum32(mm_vector const acc)
+{
+    __m128i s = _mm_hadd_epi32(acc, acc);
+    s = _mm_hadd_epi32(s, s);
+    return _mm_cvtsi128_si32(s);
+}
+
+__forceinline mm_vector add64(mm_vector const acc, mm_vector const x, bool const isMaddOverflow)
+{
+    auto lo = _mm_cvtepi32_epi64(x);
+    auto hi = _mm_cvtepi32_epi64(_mm_srli_si128(x, 8));
+    if (isMaddOverflow)
+    {
+        auto const overflow = _mm_cmpeq_epi32(x, _mm_set1_epi32(INT32_MIN));
+        auto const correction = _mm_set1_epi64x(INT64_C(1) << 32);
+        lo = _mm_add_epi64(lo, _mm_and_si128(_mm_cvtepi32_epi64(overflow), correction));
+        hi = _mm_add_epi64(hi, _mm_and_si128(_mm_cvtepi32_epi64(_mm_srli_si128(overflow, 8)), correction));
+    }
+    return _mm_add_epi64(acc, _mm_add_epi64(lo, hi));
+}
+
+__forceinline int64_t horizontalSum64(mm_vector const acc)
+{
+    return _mm_extract_epi64(acc, 0) + _mm_extract_epi64(acc, 1);
+}
+#endif
+
+// Calculates dot product of count contiguous input and filter elements
+template<typename InputType, typename FilterType>
+__forceinline int64_t dotProduct(InputType const * const input, FilterType const * const filter,
+    uint32_t const count)
+{
+    int64_t sum = 0;
+    uint32_t i = 0;
+
+#if GNA_SAT
+    // madd can overflow only for -32768 * -32768 pairs of 2B data,
+    // for 1B inputs or filters partial sums are accumulated in 32 bits
+    constexpr bool isMaddOverflow = std::is_same<InputType, int16_t>::value
+        && std::is_same<FilterType, int16_t>::value;
+    constexpr uint32_t iterations32 = isMaddOverflow ? 1 : 64;
+    auto acc64 = vec_setzero();
+
+    while (i + VEC_CAP <= count)
+    {
+        auto acc32 = vec_setzero();
+        auto const end = std::min(count - (count - i) % VEC_CAP, i + iterations32 * VEC_CAP);
+        for (; i < end; i += VEC_CAP)
+        {
+            acc32 = add32(acc32, madd(load16(input + i), load16(filter + i)));
+        }
+        acc64 = add64(acc64, acc32, isMaddOverflow);
+    }
+    sum = horizontalSum64(acc64);
+#else
+    // 32-bit wrap around gives the same result as truncated 64-bit sum
+    auto acc32 = vec_setzero();
+    for (; i + VEC_CAP <= count; i += VEC_CAP)
+    {
+        acc32 = add32(acc32, madd(load16(input + i), load16(filter + i)));
+    }
+    sum = horizontalSum32(acc32);
+#endif
+    for (; i < count; i++)
+    {
+        sum += (int64_t)input[i] * filter[i];
+    }
+    return sum;
+}
+
+template<typename InputType, typename FilterType>
+void convolution2D(ExecutionKernelConfig<ConvolutionConfig2D> const * const config)
+{
+    auto const & transform = config->RequestConfig->Transform;
+    uint32_t const inputDepth = transform.InputDepth;
+    uint32_t const inputHeight = transform.InputHeight;
+    uint32_t const inputWidth = transform.InputWidth;
+
+    uint32_t const numFilters = transform.NumberOfFilters;
+    uint32_t const filterHeight = transform.FilterHeight;
+    uint32_t const filterWidth = transform.FilterWidth;
+    uint32_t const memForFilter = filterHeight * filterWidth * inputDepth * sizeof(FilterType);
+    uint32_t const filterPadding = (ALIGN(memForFilter, 16) - memForFilter) / sizeof(FilterType);
+    uint32_t const filterSize = filterHeight * filterWidth * inputDepth + filterPadding;
+
+    uint32_t const padHeight = transform.ZeroPaddingHeight;
+    uint32_t const padWidth = transform.ZeroPaddingWidth;
+    uint32_t const strideHeight = transform.StrideHeight;
+    uint32_t const strideWidth = transform.StrideWidth;
+
+    uint32_t const outWidth = 1 + ((inputWidth + 2 * padWidth - filterWidth) / strideWidth);
+    uint32_t const firstOutputRow = transform.FirstOutputRow;
+    uint32_t const outputRowEnd = firstOutputRow + transform.OutputRowCount;
+
+    auto const * const I = reinterpret_cast<InputType const *>(config->RequestConfig->Inputs);
+    auto * O = reinterpret_cast<int32_t *>(config->RequestConfig->Outputs);
+    auto const * const F = static_cast<FilterType const *>(transform.FilterData);
+
+    auto const biasMode = transform.BiasMode;
+    auto const biasPrecission = transform.BiasDataMode;
+    auto const * const biasData = transform.BiasData;
+
+    for (uint32_t OH = firstOutputRow; OH < outputRowEnd; OH++)
+    {
+        // filter rows and columns overlapping not padded input
+        uint32_t const hIdx = OH * strideHeight;
+        uint32_t const hBegin = (hIdx < padHeight) ? padHeight - hIdx : 0;
+        uint32_t const hEnd = std::min(filterHeight, inputHeight + padHeight - std::min(hIdx, inputHeight + padHeight));
+
+        for (uint32_t OW = 0; OW < outWidth; OW++)
+        {
+            uint32_t const wIdx = OW * strideWidth;
+            uint32_t const wBegin = (wIdx < padWidth) ? padWidth - wIdx : 0;
+            uint32_t const wEnd = std::min(filterWidth, inputWidth + padWidth - std::min(wIdx, inputWidth + padWidth));
+            uint32_t const segmentSize = (wEnd > wBegin) ? (wEnd - wBegin) * inputDepth : 0;
+            uint32_t const inIdxW = (wIdx + wBegin - padWidth) * inputDepth;
+
+            for (uint32_t OD = 0; OD < numFilters; OD++)
+            {
+                int64_t outVal;
+                if (biasMode == KernelBiasModePerFilter)
+                {
+                    outVal = getBias(biasData, biasPrecission, OD);
+                }
+                else if (biasMode == KernelBiasModeDisabled)
+                {
+                    outVal = 0;
+                }
+                else
+                {
+                    outVal = getBias(biasData, biasPrecission, numFilters * outWidth * OH + numFilters * OW + OD);
+                }
+
+                if (segmentSize > 0)
+                {
+                    auto const * const filter = F + OD * filterSize + wBegin * inputDepth;
+                    for (uint32_t h = hBegin; h < hEnd; h++)
+                    {
+                        outVal += dotProduct(I + (hIdx + h - padHeight) * inputDepth * inputWidth + inIdxW,
+                            filter + inputDepth * filterWidth * h, segmentSize);
+                    }
+                }
+#if GNA_SAT
+                gna_saturate_cast(outVal, *config->SaturationCount);
+#endif
+                *O++ = (int32_t)outVal;
+            }
+        }
+    }
+}
+
+#if OPT_LEVEL > 5
+__forceinline mm_vector loadVector(void const * const data)
+{
+    return _mm256_loadu_si256((__m256i const *)data);
+}
+
+__forceinline void storeVector(void * const data, mm_vector const value)
+{
+    _mm256_storeu_si256((__m256i *)data, value);
+}
+
+__forceinline mm_vector maxVector(mm_vector const a, mm_vector const b, int8_t const *)
+{
+    return _mm256_max_epi8(a, b);
+}
+
+__forceinline mm_vector maxVector(mm_vector const a, mm_vector const b, int16_t const *)
+{
+    return _mm256_max_epi16(a, b);
+}
+
+__forceinline mm_vector maxVector(mm_vector const a, mm_vector const b, int32_t const *)
+{
+    return _mm256_max_epi32(a, b);
+}
+
+__forceinline mm_vector load32(int8_t const * const data)
+{
+    return _mm256_cvtepi8_epi32(_mm_loadl_epi64((__m128i const *)data));
+}
+
+__forceinline mm_vector load32(int16_t const * const data)
+{
+    return _mm256_cvtepi16_epi32(_mm_loadu_si128((__m128i const *)data));
+}
+
+__forceinline mm_vector load32(int32_t const * const data)
+{
+    return loadVector(data);
+}
+
+__forceinline void countSaturations(mm_vector const mask, uint32_t * const saturationCount)
+{
+    for (auto bits = (uint32_t)_mm256_movemask_ps(_mm256_castsi256_ps(mask)); bits != 0; bits &= bits - 1)
+    {
+        (*saturationCount)++;
+    }
+}
+
+// Clamps 32-bit elements to [min, max] range, counts clamped elements
+__forceinline mm_vector clamp(mm_vector const value, int32_t const min, int32_t const max,
+    uint32_t * const saturationCount)
+{
+    auto const minVector = _mm256_set1_epi32(min);
+    auto const maxVector = _mm256_set1_epi32(max);
+    countSaturations(_mm256_or_si256(_mm256_cmpgt_epi32(minVector, value),
+        _mm256_cmpgt_epi32(value, maxVector)), saturationCount);
+    return _mm256_min_epi32(_mm256_max_epi32(value, minVector), maxVector);
+}
+
+// Adds 32-bit elements saturating sums to 32 bits, counts saturated elements
+__forceinline mm_vector addSaturated(mm_vector const acc, mm_vector const x, uint32_t * const saturationCount)
+{
+    auto const sum = _mm256_add_epi32(acc, x);
+    auto const overflow = _mm256_and_si256(_mm256_xor_si256(sum, acc), _mm256_xor_si256(sum, x));
+    auto const limit = _mm256_xor_si256(_mm256_srai_epi32(acc, 31), _mm256_set1_epi32(INT32_MAX));
+    countSaturations(overflow, saturationCount);
+    return _mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(sum),
+        _mm256_castsi256_ps(limit), _mm256_castsi256_ps(overflow)));
+}
+
+// Stores 32-bit elements already clamped to output precision
+__forceinline void store32(int8_t * const output, mm_vector const value)
+{
+    auto const packed = _mm256_packs_epi16(_mm256_packs_epi32(value, value), value);
+    _mm_storel_epi64((__m128i *)output, _mm256_castsi256_si128(
+        _mm256_permutevar8x32_epi32(packed, _mm256_setr_epi32(0, 4, 0, 0, 0, 0, 0, 0))));
+}
+
+__forceinline void store32(int16_t * const output, mm_vector const value)
+{
+    auto const packed = _mm256_packs_epi32(value, value);
+    _mm_storeu_si128((__m128i *)output, _mm256_castsi256_si128(_mm256_permute4x64_epi64(packed, 0x08)));
+}
+#else // SSE4 & AVX1
+__forceinline mm_vector loadVector(void const * const data)
+{
+    return _mm_loadu_si128((__m128i const *)data);
+}
+
+__forceinline void storeVector(void * const data, mm_vector const value)
+{
+    _mm_storeu_si128((__m128i *)data, value);
+}
+
+__forceinline mm_vector maxVector(mm_vector const a, mm_vector const b, int8_t const *)
+{
+    return _mm_max_epi8(a, b);
+}
+
+__forceinline mm_vector maxVector(mm_vector const a, mm_vector const b, int16_t const *)
+{
+    return _mm_max_epi16(a, b);
+}
+
+__forceinline mm_vector maxVector(mm_vector const a, mm_vector const b, int32_t const *)
+{
+    return _mm_max_epi32(a, b);
+}
+
+__forceinline mm_vector load32(int8_t const * const data)
+{
+    int32_t packed;
+    memcpy(&packed, data, sizeof(packed));
+    return _mm_cvtepi8_epi32(_mm_cvtsi32_si128(packed));
+}
+
+__forceinline mm_vector load32(int16_t const * const data)
+{
+    return _mm_cvtepi16_epi32(_mm_loadl_epi64((__m128i const *)data));
+}
+
+__forceinline mm_vector load32(int32_t const * const data)
+{
+    return loadVector(data);
+}
+
+__forceinline void countSaturations(mm_vector const mask, uint32_t * const saturationCount)
+{
+    for (auto bits = (uint32_t)_mm_movemask_ps(_mm_castsi128_ps(mask)); bits != 0; bits &= bits - 1)
+    {
+        (*saturationCount)++;
+    }
+}
+
+__forceinline mm_vector clamp(mm_vector const value, int32_t const min, int32_t const max,
+    uint32_t * const saturationCount)
+{
+    auto const minVector = _mm_set1_epi32(min);
+    auto const maxVector = _mm_set1_epi32(max);
+    countSaturations(_mm_or_si128(_mm_cmpgt_epi32(minVector, value),
+        _mm_cmpgt_epi32(value, maxVector)), saturationCount);
+    return _mm_min_epi32(_mm_max_epi32(value, minVector), maxVector);
+}
+
+__forceinline mm_vector addSaturated(mm_vector const acc, mm_vector const x, uint32_t * const saturationCount)
+{
+    auto const sum = _mm_add_epi32(acc, x);
+    auto const overflow = _mm_and_si128(_mm_xor_si128(sum, acc), _mm_xor_si128(sum, x));
+    auto const limit = _mm_xor_si128(_mm_srai_epi32(acc, 31), _mm_set1_epi32(INT32_MAX));
+    countSaturations(overflow, saturationCount);
+    return _mm_blendv_epi8(sum, limit, _mm_srai_epi32(overflow, 31));
+}
+
+__forceinline void store32(int8_t * const output, mm_vector const value)
+{
+    auto const packed = _mm_packs_epi16(_mm_packs_epi32(value, value), value);
+    auto const out = _mm_cvtsi128_si32(packed);
+    memcpy(output, &out, sizeof(out));
+}
+
+__forceinline void store32(int16_t * const output, mm_vector const value)
+{
+    _mm_storel_epi64((__m128i *)output, _mm_packs_epi32(value, value));
+}
+#endif
+
+__forceinline void store32(int32_t * const output, mm_vector const value)
+{
+    storeVector(output, value);
+}
+
+// Sum pooling saturates running sum to 16 bits for 1B data and 32 bits otherwise,
+// and the result to data precision
+template<typename DataType>
+struct SumPoolingLimits
+{
+    typedef typename std::conditional<sizeof(DataType) == 1, int16_t, int32_t>::type Intermediate;
+};
+
+template<typename DataType>
+__forceinline mm_vector addPooled(mm_vector const acc, mm_vector const x, uint32_t * const saturationCount)
+{
+    if (sizeof(DataType) == 1)
+    {
+        return clamp(add32(acc, x), INT16_MIN, INT16_MAX, saturationCount);
+    }
+    return addSaturated(acc, x, saturationCount);
+}
+
+template<typename DataType>
+__forceinline void storePooled(DataType * const output, mm_vector const value, uint32_t * const saturationCount)
+{
+    if (sizeof(DataType) < sizeof(int32_t))
+    {
+        store32(output, clamp(value, (std::numeric_limits<DataType>::min)(),
+            (std::numeric_limits<DataType>::max)(), saturationCount));
+    }
+    else
+    {
+        store32(output, value);
+    }
+}
+
+// Pools window of rowCount x columnCount elements starting at input for all channels
+template<typename DataType>
+void poolMax(DataType const * const input, uint32_t const rowCount, uint32_t const columnCount,
+    uint32_t const rowStride, uint32_t const channelCount, DataType * const output)
+{
+    constexpr uint32_t lanes = sizeof(mm_vector) / sizeof(DataType);
+    uint32_t c = 0;
+
+    for (; c + lanes <= channelCount; c += lanes)
+    {
+        auto acc = loadVector(input + c);
+        for (uint32_t w = 0; w < columnCount; w++)
+        {
+            for (uint32_t h = 0; h < rowCount; h++)
+            {
+                acc = maxVector(acc, loadVector(input + h * rowStride + w * channelCount + c), input);
+            }
+        }
+        storeVector(output + c, acc);
+    }
+    for (; c < channelCount; c++)
+    {
+        auto value = input[c];
+        for (uint32_t w = 0; w < columnCount; w++)
+        {
+            for (uint32_t h = 0; h < rowCount; h++)
+            {
+                value = (std::max)(value, input[h * rowStride + w * channelCount + c]);
+            }
+        }
+        output[c] = value;
+    }
+}
+
+template<typename DataType>
+void poolSum(DataType const * const input, uint32_t const rowCount, uint32_t const columnCount,
+    uint32_t const rowStride, uint32_t const channelCount, DataType * const output,
+    uint32_t * const saturationCount)
+{
+    constexpr uint32_t lanes = sizeof(mm_vector) / sizeof(int32_t);
+    uint32_t c = 0;
+
+    for (; c + lanes <= channelCount; c += lanes)
+    {
+        auto acc = vec_setzero();
+        for (uint32_t w = 0; w < columnCount; w++)
+        {
+            for (uint32_t h = 0; h < rowCount; h++)
+            {
+                acc = addPooled<DataType>(acc, load32(input + h * rowStride + w * channelCount + c), saturationCount);
+            }
+        }
+        storePooled(output + c, acc, saturationCount);
+    }
+    for (; c < channelCount; c++)
+    {
+        int64_t value = 0;
+        for (uint32_t w = 0; w < columnCount; w++)
+        {
+            for (uint32_t h = 0; h < rowCount; h++)
+            {
+                value += input[h * rowStride + w * channelCount + c];
+                gna_saturate_cast<typename SumPoolingLimits<DataType>::Intermediate>(value, *saturationCount);
+            }
+        }
+        gna_saturate_cast<DataType>(value, *saturationCount);
+        output[c] = static_cast<DataType>(value);
+    }
+}
+
+template<typename DataType>
+void pooling2D(ExecutionKernelConfig<PoolingConfig2D> const * const config)
+{
+    auto const & transform = config->RequestConfig->Transform;
+    auto const * const I = reinterpret_cast<DataType const *>(config->RequestConfig->Inputs);
+    auto * const O = reinterpret_cast<DataType *>(config->RequestConfig->Outputs);
+
+    uint32_t const inputW = transform.InputWidth;
+    uint32_t const inputH = transform.InputHeight;
+    uint32_t const numFilters = transform.InputDepth;
+
+    uint32_t const poolStrideH = transform.StrideHeight;
+    uint32_t const poolStrideW = transform.StrideWidth;
+    uint32_t const windowHeight = transform.WindowHeight;
+    uint32_t const windowWidth = transform.WindowWidth;
+
+    uint32_t const wDimPartial = (inputW < windowWidth) ? 0 : inputW - windowWidth;
+    uint32_t const hDimPartial = (inputH < windowHeight) ? 0 : inputH - windowHeight;
+    uint32_t const poolOutW = 1 + (uint32_t)std::ceil((float)(wDimPartial) / (float)poolStrideW);
+    uint32_t const poolOutH = 1 + (uint32_t)std::ceil((float)(hDimPartial) / (float)poolStrideH);
+
+#if GNA_SAT
+    auto * const saturationCount = config->SaturationCount;
+#else
+    uint32_t ignoredSaturations = 0;
+    auto * const saturationCount = &ignoredSaturations;
+#endif
+
+    for (uint32_t POH = 0; POH < poolOutH; POH++)
+    {
+        uint32_t const hBegin = POH * poolStrideH;
+        uint32_t const rowCount = (hBegin < inputH) ? (std::min)(hBegin + windowHeight, inputH) - hBegin : 0;
+
+        for (uint32_t POW = 0; POW < poolOutW; POW++)
+        {
+            uint32_t const wBegin = POW * poolStrideW;
+            uint32_t const columnCount = (wBegin < inputW) ? (std::min)(wBegin + windowWidth, inputW) - wBegin : 0;
+            auto const * const window = I + (hBegin * inputW + wBegin) * numFilters;
+            auto * const output = O + (POH * poolOutW + POW) * numFilters;
+
+            // windows starting beyond input, due to stride larger than window, are empty
+            if (0 == rowCount || 0 == columnCount)
+            {
+                memset(output, 0, numFilters * sizeof(DataType));
+            }
+            else if (transform.Mode == KernelPoolingModeMax)
+            {
+                poolMax(window, rowCount, columnCount, inputW * numFilters, numFilters, output);
+            }
+            else if (transform.Mode == KernelPoolingModeSum)
+            {
+                poolSum(window, rowCount, columnCount, inputW * numFilters, numFilters, output, saturationCount);
+            }
+        }
+    }
+}
+
+}
+
+void Convolution2DKernelImpl1B1B(ExecutionKernelConfig<ConvolutionConfig2D> const * const config)
+{
+    convolution2D<int8_t, int8_t>(config);
+}
+
+void Convolution2DKernelImpl1B2B(ExecutionKernelConfig<ConvolutionConfig2D> const * const config)
+{
+    convolution2D<int16_t, int8_t>(config);
+}
+
+void Convolution2DKernelImpl2B1B(ExecutionKernelConfig<ConvolutionConfig2D> const * const config)
+{
+    convolution2D<int8_t, int16_t>(config);
+}
+
+void Convolution2DKernelImpl2B2B(ExecutionKernelConfig<ConvolutionConfig2D> const * const config)
+{
+    convolution2D<int16_t, int16_t>(config);
+}
+
+void Pooling2DKernelImpl1B(ExecutionKernelConfig<PoolingConfig2D> const * const config)
+{
+    pooling2D<int8_t>(config);
+}
+
+void Pooling2DKernelImpl2B(ExecutionKernelConfig<PoolingConfig2D> const * const config)
+{
+    pooling2D<int16_t>(config);
+}
+
+void Pooling2DKernelImpl4B(ExecutionKernelConfig<PoolingConfig2D> const * const config)
+{
+    pooling2D<int32_t>(config);
+}
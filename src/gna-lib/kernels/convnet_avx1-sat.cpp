@@ -338,7 +338,7 @@ void ConvolutionPoolingKernelImpl(ConvolutionConfig const * const filterConfig,
         return;
     }
 
-    pwl->KERNEL(InitializeActivationFunctions)();
+    auto const activateSingle = pwl->KERNEL(GetActivationFunctions)().ActivateSingle;
 
     void(*func_partial_pooling)(const uint32_t PS, const uint32_t pool_num_entries, const uint32_t pool_start_index, const int64_t *P, int64_t *V);
 
@@ -893,7 +893,7 @@ void ConvolutionPoolingKernelImpl(ConvolutionConfig const * const filterConfig,
 #if GNA_SAT == 1
                     gna_saturate_cast(value, *saturationCount);
 #endif
-                    pwl->ActivateSingle(&pwl->pwl, (int32_t)value, &O[output_index * FN + i], saturationCount);
+                    activateSingle(&pwl->pwl, (int32_t)value, &O[output_index * FN + i], saturationCount);
                 }
 
                 pool_start_index = (pool_start_index + PSTEP) % PS;
@@ -921,7 +921,7 @@ void ConvolutionPoolingKernelImpl(ConvolutionConfig const * const filterConfig,
 #if GNA_SAT == 1
             gna_saturate_cast(value, *saturationCount);
 #endif
-            pwl->ActivateSingle(&pwl->pwl, (int32_t)value, &O[output_index * FN + i], saturationCount);
+            activateSingle(&pwl->pwl, (int32_t)value, &O[output_index * FN + i], saturationCount);
         }
 
         pool_start_index = (pool_start_index + PSTEP) % PS;
@@ -238,7 +238,7 @@ void ConvolutionPoolingKernelImpl(ConvolutionConfig const * const filterConfig,
         return;
     }
 
-    pwl->KERNEL(InitializeActivationFunctions)();
+    auto const activateSingle = pwl->KERNEL(GetActivationFunctions)().ActivateSingle;
 
     void(*func_partial_pooling)(const uint32_t PS, const uint32_t pool_num_entries, const uint32_t pool_start_index, const int64_t* P, int64_t *V);
 
@@ -328,7 +328,7 @@ void ConvolutionPoolingKernelImpl(ConvolutionConfig const * const filterConfig,
                 {
                     func_partial_pooling(PS, PS, 0, pool + i * CNN_POOL_SIZE_MAX, &value);
                     gna_saturate_cast(value, *saturationCount);
-                    pwl->ActivateSingle(&pwl->pwl, (int32_t)value, &O[output_index * FN + i], saturationCount);
+                    activateSingle(&pwl->pwl, (int32_t)value, &O[output_index * FN + i], saturationCount);
                 }
 
                 pool_start_index = (pool_start_index + PSTEP) % PS;
@@ -354,7 +354,7 @@ void ConvolutionPoolingKernelImpl(ConvolutionConfig const * const filterConfig,
         {
             func_partial_pooling(PS, static_cast<uint32_t>(pool_num_entries), pool_start_index, pool + i * CNN_POOL_SIZE_MAX, &value);
             gna_saturate_cast(value, *saturationCount);
-            pwl->ActivateSingle(&pwl->pwl, (int32_t)value, &O[output_index * FN + i], saturationCount);
+            activateSingle(&pwl->pwl, (int32_t)value, &O[output_index * FN + i], saturationCount);
         }
 
         pool_start_index = (pool_start_index + PSTEP) % PS;
@@ -384,7 +384,7 @@ void ConvolutionPoolingKernelImpl1B(ConvolutionConfig const * const filterConfig
         return;
     }
 
-    pwl->KERNEL(InitializeActivationFunctions)();
+    auto const activateSingle = pwl->KERNEL(GetActivationFunctions)().ActivateSingle;
 
     void(*func_partial_pooling)(const uint32_t PS, const uint32_t pool_num_entries, const uint32_t pool_start_index, const int64_t *P, int64_t *V);
 
@@ -474,7 +474,7 @@ void ConvolutionPoolingKernelImpl1B(ConvolutionConfig const * const filterConfig
                 {
                     func_partial_pooling(PS, PS, 0, pool + i * CNN_POOL_SIZE_MAX, &value);
                     gna_saturate_cast(value, *saturationCount);
-                    pwl->ActivateSingle(&pwl->pwl, (int32_t)value, (int16_t*)&(O[(output_index * FN + i) * pwl->pwl.bytesPerOutput]), saturationCount);
+                    activateSingle(&pwl->pwl, (int32_t)value, (int16_t*)&(O[(output_index * FN + i) * pwl->pwl.bytesPerOutput]), saturationCount);
                 }
 
                 pool_start_index = (pool_start_index + PSTEP) % PS;
@@ -500,7 +500,7 @@ void ConvolutionPoolingKernelImpl1B(ConvolutionConfig const * const filterConfig
         {
             func_partial_pooling(PS, static_cast<uint32_t>(pool_num_entries), pool_start_index, pool + i * CNN_POOL_SIZE_MAX, &value);
             gna_saturate_cast(value, *saturationCount);
-            pwl->ActivateSingle(&pwl->pwl, (int32_t)value, (int16_t*)&(O[(output_index * FN + i) * pwl->pwl.bytesPerOutput]), saturationCount);
+            activateSingle(&pwl->pwl, (int32_t)value, (int16_t*)&(O[(output_index * FN + i) * pwl->pwl.bytesPerOutput]), saturationCount);
         }
 
         pool_start_index = (pool_start_index + PSTEP) % PS;
@@ -530,7 +530,7 @@ void ConvolutionPoolingKernelImpl2B(ConvolutionConfig const * const filterConfig
         return;
     }
 
-    pwl->KERNEL(InitializeActivationFunctions)();
+    auto const activateSingle = pwl->KERNEL(GetActivationFunctions)().ActivateSingle;
 
     void(*func_partial_pooling)(const uint32_t PS, const uint32_t pool_num_entries, const uint32_t pool_start_index, const int64_t *P, int64_t *V);
 
@@ -620,7 +620,7 @@ void ConvolutionPoolingKernelImpl2B(ConvolutionConfig const * const filterConfig
                 {
                     func_partial_pooling(PS, PS, 0, pool + i * CNN_POOL_SIZE_MAX, &value);
                     gna_saturate_cast(value, *saturationCount);
-                    pwl->ActivateSingle(&pwl->pwl, (int32_t)value, (int16_t*)&(O[(output_index * FN + i) * pwl->pwl.bytesPerOutput]), saturationCount);
+                    activateSingle(&pwl->pwl, (int32_t)value, (int16_t*)&(O[(output_index * FN + i) * pwl->pwl.bytesPerOutput]), saturationCount);
                 }
 
                 pool_start_index = (pool_start_index + PSTEP) % PS;
@@ -646,7 +646,7 @@ void ConvolutionPoolingKernelImpl2B(ConvolutionConfig const * const filterConfig
         {
             func_partial_pooling(PS, static_cast<uint32_t>(pool_num_entries), pool_start_index, pool + i * CNN_POOL_SIZE_MAX, &value);
             gna_saturate_cast(value, *saturationCount);
-            pwl->ActivateSingle(&pwl->pwl, (int32_t)value, (int16_t*)&(O[(output_index * FN + i) * pwl->pwl.bytesPerOutput]), saturationCount);
+            activateSingle(&pwl->pwl, (int32_t)value, (int16_t*)&(O[(output_index * FN + i) * pwl->pwl.bytesPerOutput]), saturationCount);
         }
 
         pool_start_index = (pool_start_index + PSTEP) % PS;
@@ -908,7 +908,6 @@ void Convolution2DKernelImpl1B1B(ExecutionKernelConfig<ConvolutionConfig2D> cons
 
     auto biasMode = config->RequestConfig->Transform.BiasMode;
 
-    uint32_t inputHeightWPad = inputHeight + 2 * padHeight;
     uint32_t inputWidthWPad = inputWidth + 2 * padWidth;
     uint32_t inWidthMax = inputWidth + padWidth - 1;
     uint32_t inHeightMax = inputHeight + padHeight - 1;
@@ -921,7 +920,8 @@ void Convolution2DKernelImpl1B1B(ExecutionKernelConfig<ConvolutionConfig2D> cons
     const void* biasData = config->RequestConfig->Transform.BiasData;
 
     uint32_t outWidth = 1 + ((inputWidthWPad - filterWidth) / strideWidth);
-    uint32_t outHeight = 1 + ((inputHeightWPad - filterHeight) / strideHeight);
+    uint32_t firstOutputRow = config->RequestConfig->Transform.FirstOutputRow;
+    uint32_t outHeight = firstOutputRow + config->RequestConfig->Transform.OutputRowCount;
 
     for (uint32_t OD = 0; OD < numFilters; OD++)
     { //Output depth or #filters
@@ -930,7 +930,7 @@ void Convolution2DKernelImpl1B1B(ExecutionKernelConfig<ConvolutionConfig2D> cons
 
         for (uint32_t OW = 0; OW < outWidth; OW++)
         { //Output width
-            for (uint32_t OH = 0; OH < outHeight; OH++)
+            for (uint32_t OH = firstOutputRow; OH < outHeight; OH++)
             {    //Output height
 
                 int64_t outVal;// = &O[OH * outWidth * numFilters + OW * numFilters + OD]; //NHWC order
@@ -973,7 +973,7 @@ void Convolution2DKernelImpl1B1B(ExecutionKernelConfig<ConvolutionConfig2D> cons
                 }
 
                 gna_saturate_cast(outVal, *config->SaturationCount);
-                O[OH * outWidth * numFilters + OW * numFilters + OD] = (int32_t)outVal;
+                O[(OH - firstOutputRow) * outWidth * numFilters + OW * numFilters + OD] = (int32_t)outVal;
             }
         }
     }
@@ -998,7 +998,6 @@ void Convolution2DKernelImpl1B2B(ExecutionKernelConfig<ConvolutionConfig2D> cons
 
     auto biasMode = config->RequestConfig->Transform.BiasMode;
 
-    uint32_t inputHeightWPad = inputHeight + 2 * padHeight;
     uint32_t inputWidthWPad = inputWidth + 2 * padWidth;
     uint32_t inWidthMax = inputWidth + padWidth - 1;
     uint32_t inHeightMax = inputHeight + padHeight - 1;
@@ -1011,7 +1010,8 @@ void Convolution2DKernelImpl1B2B(ExecutionKernelConfig<ConvolutionConfig2D> cons
     const void* biasData = config->RequestConfig->Transform.BiasData;
 
     uint32_t outWidth = 1 + ((inputWidthWPad - filterWidth) / strideWidth);
-    uint32_t outHeight = 1 + ((inputHeightWPad - filterHeight) / strideHeight);
+    uint32_t firstOutputRow = config->RequestConfig->Transform.FirstOutputRow;
+    uint32_t outHeight = firstOutputRow + config->RequestConfig->Transform.OutputRowCount;
 
     for (uint32_t OD = 0; OD < numFilters; OD++)
     { //Output depth or #filters
@@ -1020,7 +1020,7 @@ void Convolution2DKernelImpl1B2B(ExecutionKernelConfig<ConvolutionConfig2D> cons
 
         for (uint32_t OW = 0; OW < outWidth; OW++)
         { //Output width
-            for (uint32_t OH = 0; OH < outHeight; OH++)
+            for (uint32_t OH = firstOutputRow; OH < outHeight; OH++)
             {    //Output height
 
                 int64_t outVal;// = &O[OH * outWidth * numFilters + OW * numFilters + OD]; //NHWC order
@@ -1064,7 +1064,7 @@ void Convolution2DKernelImpl1B2B(ExecutionKernelConfig<ConvolutionConfig2D> cons
                 }
 
                 gna_saturate_cast(outVal, *config->SaturationCount);
-                O[OH * outWidth * numFilters + OW * numFilters + OD] = (int32_t)outVal;
+                O[(OH - firstOutputRow) * outWidth * numFilters + OW * numFilters + OD] = (int32_t)outVal;
             }
         }
     }
@@ -1089,7 +1089,6 @@ void Convolution2DKernelImpl2B1B(ExecutionKernelConfig<ConvolutionConfig2D> cons
 
     auto biasMode = config->RequestConfig->Transform.BiasMode;
 
-    uint32_t inputHeightWPad = inputHeight + 2 * padHeight;
     uint32_t inputWidthWPad = inputWidth + 2 * padWidth;
     uint32_t inWidthMax = inputWidth + padWidth - 1;
     uint32_t inHeightMax = inputHeight + padHeight - 1;
@@ -1102,7 +1101,8 @@ void Convolution2DKernelImpl2B1B(ExecutionKernelConfig<ConvolutionConfig2D> cons
     const void* biasData = config->RequestConfig->Transform.BiasData;
 
     uint32_t outWidth = 1 + ((inputWidthWPad - filterWidth) / strideWidth);
-    uint32_t outHeight = 1 + ((inputHeightWPad - filterHeight) / strideHeight);
+    uint32_t firstOutputRow = config->RequestConfig->Transform.FirstOutputRow;
+    uint32_t outHeight = firstOutputRow + config->RequestConfig->Transform.OutputRowCount;
 
     for (uint32_t OD = 0; OD < numFilters; OD++)
     { //Output depth or #filters
@@ -1111,7 +1111,7 @@ void Convolution2DKernelImpl2B1B(ExecutionKernelConfig<ConvolutionConfig2D> cons
 
         for (uint32_t OW = 0; OW < outWidth; OW++)
         { //Output width
-            for (uint32_t OH = 0; OH < outHeight; OH++)
+            for (uint32_t OH = firstOutputRow; OH < outHeight; OH++)
             {    //Output height
 
                 int64_t outVal;// = &O[OH * outWidth * numFilters + OW * numFilters + OD]; //NHWC order
@@ -1154,7 +1154,7 @@ void Convolution2DKernelImpl2B1B(ExecutionKernelConfig<ConvolutionConfig2D> cons
                 }
 
                 gna_saturate_cast(outVal, *config->SaturationCount);
-                O[OH * outWidth * numFilters + OW * numFilters + OD] = (int32_t)outVal;
+                O[(OH - firstOutputRow) * outWidth * numFilters + OW * numFilters + OD] = (int32_t)outVal;
             }
         }
     }
@@ -1180,7 +1180,6 @@ void Convolution2DKernelImpl2B2B(ExecutionKernelConfig<ConvolutionConfig2D> cons
 
     auto biasMode = config->RequestConfig->Transform.BiasMode;
 
-    uint32_t inputHeightWPad = inputHeight + 2 * padHeight;
     uint32_t inputWidthWPad = inputWidth + 2 * padWidth;
     uint32_t inWidthMax = inputWidth + padWidth - 1;
     uint32_t inHeightMax = inputHeight + padHeight - 1;
@@ -1193,7 +1192,8 @@ void Convolution2DKernelImpl2B2B(ExecutionKernelConfig<ConvolutionConfig2D> cons
     const void* biasData = config->RequestConfig->Transform.BiasData;
 
     uint32_t outWidth = 1 + ((inputWidthWPad - filterWidth) / strideWidth);
-    uint32_t outHeight = 1 + ((inputHeightWPad - filterHeight) / strideHeight);
+    uint32_t firstOutputRow = config->RequestConfig->Transform.FirstOutputRow;
+    uint32_t outHeight = firstOutputRow + config->RequestConfig->Transform.OutputRowCount;
 
     for (uint32_t OD = 0; OD < numFilters; OD++)
     { //Output depth or #filters
@@ -1202,7 +1202,7 @@ void Convolution2DKernelImpl2B2B(ExecutionKernelConfig<ConvolutionConfig2D> cons
 
         for (uint32_t OW = 0; OW < outWidth; OW++)
         { //Output width
-            for (uint32_t OH = 0; OH < outHeight; OH++)
+            for (uint32_t OH = firstOutputRow; OH < outHeight; OH++)
             {    //Output height
 
                 int64_t outVal;// = &O[OH * outWidth * numFilters + OW * numFilters + OD]; //NHWC order
@@ -1246,7 +1246,7 @@ void Convolution2DKernelImpl2B2B(ExecutionKernelConfig<ConvolutionConfig2D> cons
                 }
 
                 gna_saturate_cast(outVal, *config->SaturationCount);
-                O[OH * outWidth * numFilters + OW * numFilters + OD] = (int32_t)outVal;
+                O[(OH - firstOutputRow) * outWidth * numFilters + OW * numFilters + OD] = (int32_t)outVal;
             }
         }
     }
@@ -15,6 +15,7 @@
 #include "common.h"
 #include "gna-api-types-xnn.h"
 
+#include <algorithm>
 #include <cmath>
 #include <cstdint>
 
@@ -232,7 +233,7 @@ void ConvolutionPoolingKernelImpl(ConvolutionConfig const * const filterConfig,
         return;
     }
 
-    pwl->KERNEL(InitializeActivationFunctions)();
+    auto const activateSingle = pwl->KERNEL(GetActivationFunctions)().ActivateSingle;
 
     void(*func_partial_pooling)(const uint32_t PS, const uint32_t pool_num_entries, const uint32_t pool_start_index, const int64_t* P, int64_t *V);
 
@@ -314,7 +315,7 @@ void ConvolutionPoolingKernelImpl(ConvolutionConfig const * const filterConfig,
                 for (i = 0; i < FN; i++)
                 {
                     func_partial_pooling(PS, PS, 0, pool + i * CNN_POOL_SIZE_MAX, &value);
-                    pwl->ActivateSingle(&pwl->pwl, (int32_t)value, &O[output_index * FN + i], saturationCount);
+                    activateSingle(&pwl->pwl, (int32_t)value, &O[output_index * FN + i], saturationCount);
                 }
 
                 pool_start_index = (pool_start_index + PSTEP) % PS;
@@ -339,7 +340,7 @@ void ConvolutionPoolingKernelImpl(ConvolutionConfig const * const filterConfig,
         for (i = 0; i < FN; i++)
         {
             func_partial_pooling(PS, static_cast<uint32_t>(pool_num_entries), pool_start_index, pool + i * CNN_POOL_SIZE_MAX, &value);
-            pwl->ActivateSingle(&pwl->pwl, (int32_t)value, &O[output_index * FN + i], saturationCount);
+            activateSingle(&pwl->pwl, (int32_t)value, &O[output_index * FN + i], saturationCount);
         }
 
         pool_start_index = (pool_start_index + PSTEP) % PS;
@@ -369,7 +370,7 @@ void ConvolutionPoolingKernelImpl1B(ConvolutionConfig const * const filterConfig
         return;
     }
 
-    pwl->KERNEL(InitializeActivationFunctions)();
+    auto const activateSingle = pwl->KERNEL(GetActivationFunctions)().ActivateSingle;
 
     void(*func_partial_pooling)(const uint32_t PS, const uint32_t pool_num_entries, const uint32_t pool_start_index, const int64_t* P, int64_t *V);
 
@@ -458,7 +459,7 @@ void ConvolutionPoolingKernelImpl1B(ConvolutionConfig const * const filterConfig
                 for (i = 0; i < FN; i++)
                 {
                     func_partial_pooling(PS, PS, 0, pool + i * CNN_POOL_SIZE_MAX, &value);
-                    pwl->ActivateSingle(&pwl->pwl, (int32_t)value, (int16_t*)&O[(output_index * FN + i) * pwl->pwl.bytesPerOutput], saturationCount);
+                    activateSingle(&pwl->pwl, (int32_t)value, (int16_t*)&O[(output_index * FN + i) * pwl->pwl.bytesPerOutput], saturationCount);
                 }
 
                 pool_start_index = (pool_start_index + PSTEP) % PS;
@@ -483,7 +484,7 @@ void ConvolutionPoolingKernelImpl1B(ConvolutionConfig const * const filterConfig
         for (i = 0; i < FN; i++)
         {
             func_partial_pooling(PS, static_cast<uint32_t>(pool_num_entries), pool_start_index, pool + i * CNN_POOL_SIZE_MAX, &value);
-            pwl->ActivateSingle(&pwl->pwl, (int32_t)value, (int16_t*)&O[(output_index * FN + i) * pwl->pwl.bytesPerOutput], saturationCount);
+            activateSingle(&pwl->pwl, (int32_t)value, (int16_t*)&O[(output_index * FN + i) * pwl->pwl.bytesPerOutput], saturationCount);
         }
 
         pool_start_index = (pool_start_index + PSTEP) % PS;
@@ -513,7 +514,7 @@ void ConvolutionPoolingKernelImpl2B(ConvolutionConfig const * const filterConfig
         return;
     }
 
-    pwl->KERNEL(InitializeActivationFunctions)();
+    auto const activateSingle = pwl->KERNEL(GetActivationFunctions)().ActivateSingle;
 
     void(*func_partial_pooling)(const uint32_t PS, const uint32_t pool_num_entries, const uint32_t pool_start_index, const int64_t* P, int64_t *V);
 
@@ -602,7 +603,7 @@ void ConvolutionPoolingKernelImpl2B(ConvolutionConfig const * const filterConfig
                 for (i = 0; i < FN; i++)
                 {
                     func_partial_pooling(PS, PS, 0, pool + i * CNN_POOL_SIZE_MAX, &value);
-                    pwl->ActivateSingle(&pwl->pwl, (int32_t)value, (int16_t*)&(O[(output_index * FN + i) * pwl->pwl.bytesPerOutput]), saturationCount);
+                    activateSingle(&pwl->pwl, (int32_t)value, (int16_t*)&(O[(output_index * FN + i) * pwl->pwl.bytesPerOutput]), saturationCount);
                 }
 
                 pool_start_index = (pool_start_index + PSTEP) % PS;
@@ -627,7 +628,7 @@ void ConvolutionPoolingKernelImpl2B(ConvolutionConfig const * const filterConfig
         for (i = 0; i < FN; i++)
         {
             func_partial_pooling(PS, static_cast<uint32_t>(pool_num_entries), pool_start_index, pool + i * CNN_POOL_SIZE_MAX, &value);
-            pwl->ActivateSingle(&pwl->pwl, (int32_t)value, (int16_t*)&(O[(output_index * FN + i) * pwl->pwl.bytesPerOutput]), saturationCount);
+            activateSingle(&pwl->pwl, (int32_t)value, (int16_t*)&(O[(output_index * FN + i) * pwl->pwl.bytesPerOutput]), saturationCount);
         }
 
         pool_start_index = (pool_start_index + PSTEP) % PS;
@@ -702,24 +703,14 @@ void Pooling2DKernelImpl1B(ExecutionKernelConfig<PoolingConfig2D> const * const
                             if ((POW * poolStrideW + OW <= (inputW - 1)) && (POH * poolStrideH + OH <= (inputH - 1)))
                             {
                                 tmpValue += I[OD + inIdxW + inIdxH + winIdxW + winIdxH];
+                                tmpValue = (std::min)((std::max)(tmpValue, (int64_t)INT16_MIN), (int64_t)INT16_MAX);
                             }
-
-                            if (value > INT8_MAX)
-                            {
-                                value = INT8_MAX;
-                            }
-                            else if (value < INT8_MIN)
-                            {
-                                value = INT8_MIN;
-                            }
-                            else
-                            {
-                                value = tmpValue;
-                            }
+                            value = tmpValue;
                         }
                     }
                 }
 
+                value = (std::min)((std::max)(value, (int64_t)INT8_MIN), (int64_t)INT8_MAX);
                 O[POH * poolOutW * numFilters + POW * numFilters + OD] = (int8_t)value;
             }
         }
@@ -792,24 +783,14 @@ void Pooling2DKernelImpl2B(ExecutionKernelConfig<PoolingConfig2D> const * const
                             if ((POW * poolStrideW + OW <= (inputW - 1)) && (POH * poolStrideH + OH <= (inputH - 1)))
                             {
                                 tmpValue += I[OD + inIdxW + inIdxH + winIdxW + winIdxH];
+                                tmpValue = (std::min)((std::max)(tmpValue, (int64_t)INT32_MIN), (int64_t)INT32_MAX);
                             }
-
-                            if (value > INT16_MAX)
-                            {
-                                value = INT16_MAX;
-                            }
-                            else if (value < INT16_MIN)
-                            {
-                                value = INT16_MIN;
-                            }
-                            else
-                            {
-                                value = tmpValue;
-                            }
+                            value = tmpValue;
                         }
                     }
                 }
 
+                value = (std::min)((std::max)(value, (int64_t)INT16_MIN), (int64_t)INT16_MAX);
                 O[POH * poolOutW * numFilters + POW * numFilters + OD] = (int16_t)value;
             }
         }
@@ -882,24 +863,14 @@ void Pooling2DKernelImpl4B(ExecutionKernelConfig<PoolingConfig2D> const * const
                             if ((POW * poolStrideW + OW <= (inputW - 1)) && (POH * poolStrideH + OH <= (inputH - 1)))
                             {
                                 tmpValue += I[OD + inIdxW + inIdxH + winIdxW + winIdxH];
+                                tmpValue = (std::min)((std::max)(tmpValue, (int64_t)INT32_MIN), (int64_t)INT32_MAX);
                             }
-
-                            if (value > INT32_MAX)
-                            {
-                                value = INT32_MAX;
-                            }
-                            else if (value < INT32_MIN)
-                            {
-                                value = INT32_MIN;
-                            }
-                            else
-                            {
-                                value = tmpValue;
-                            }
+                            value = tmpValue;
                         }
                     }
                 }
 
+                value = (std::min)((std::max)(value, (int64_t)INT32_MIN), (int64_t)INT32_MAX);
                 O[POH * poolOutW * numFilters + POW * numFilters + OD] = (int32_t)value;
             }
         }
@@ -926,7 +897,6 @@ void Convolution2DKernelImpl1B1B(ExecutionKernelConfig<ConvolutionConfig2D> cons
 
     auto biasMode = config->RequestConfig->Transform.BiasMode;
 
-    uint32_t inputHeightWPad = inputHeight + 2 * padHeight;
     uint32_t inputWidthWPad = inputWidth + 2 * padWidth;
     uint32_t inWidthMax = inputWidth + padWidth - 1;
     uint32_t inHeightMax = inputHeight + padHeight - 1;
@@ -939,14 +909,15 @@ void Convolution2DKernelImpl1B1B(ExecutionKernelConfig<ConvolutionConfig2D> cons
     const void* biasData = config->RequestConfig->Transform.BiasData;
 
     uint32_t outWidth = 1 + ((inputWidthWPad - filterWidth) / strideWidth);
-    uint32_t outHeight = 1 + ((inputHeightWPad - filterHeight) / strideHeight);
+    uint32_t firstOutputRow = config->RequestConfig->Transform.FirstOutputRow;
+    uint32_t outHeight = firstOutputRow + config->RequestConfig->Transform.OutputRowCount;
 
     for (uint32_t OD = 0; OD < numFilters; OD++) { //Output depth or #filters
 
         uint32_t fIdxN = (OD * (inputDepth * filterWidth * filterHeight + filterPadding));
 
         for (uint32_t OW = 0; OW < outWidth; OW++) { //Output width
-            for (uint32_t OH = 0; OH < outHeight; OH++) {    //Output height
+            for (uint32_t OH = firstOutputRow; OH < outHeight; OH++) {    //Output height
 
                 int64_t outVal;// = &O[OH * outWidth * numFilters + OW * numFilters + OD]; //NHWC order
                 if (biasMode == KernelBiasModePerFilter) {
@@ -981,7 +952,7 @@ void Convolution2DKernelImpl1B1B(ExecutionKernelConfig<ConvolutionConfig2D> cons
                     }
                 }
 
-                O[OH * outWidth * numFilters + OW * numFilters + OD] = (int32_t)outVal;
+                O[(OH - firstOutputRow) * outWidth * numFilters + OW * numFilters + OD] = (int32_t)outVal;
             }
         }
     }
@@ -1006,7 +977,6 @@ void Convolution2DKernelImpl1B2B(ExecutionKernelConfig<ConvolutionConfig2D> cons
 
     auto biasMode = config->RequestConfig->Transform.BiasMode;
 
-    uint32_t inputHeightWPad = inputHeight + 2 * padHeight;
     uint32_t inputWidthWPad = inputWidth + 2 * padWidth;
     uint32_t inWidthMax = inputWidth + padWidth - 1;
     uint32_t inHeightMax = inputHeight + padHeight - 1;
@@ -1019,14 +989,15 @@ void Convolution2DKernelImpl1B2B(ExecutionKernelConfig<ConvolutionConfig2D> cons
     const void* biasData = config->RequestConfig->Transform.BiasData;
 
     uint32_t outWidth = 1 + ((inputWidthWPad - filterWidth) / strideWidth);
-    uint32_t outHeight = 1 + ((inputHeightWPad - filterHeight) / strideHeight);
+    uint32_t firstOutputRow = config->RequestConfig->Transform.FirstOutputRow;
+    uint32_t outHeight = firstOutputRow + config->RequestConfig->Transform.OutputRowCount;
 
     for (uint32_t OD = 0; OD < numFilters; OD++) { //Output depth or #filters
 
         uint32_t fIdxN = (OD * (inputDepth * filterWidth * filterHeight + filterPadding));
 
         for (uint32_t OW = 0; OW < outWidth; OW++) { //Output width
-            for (uint32_t OH = 0; OH < outHeight; OH++) {    //Output height
+            for (uint32_t OH = firstOutputRow; OH < outHeight; OH++) {    //Output height
 
                 int64_t outVal;// = &O[OH * outWidth * numFilters + OW * numFilters + OD]; //NHWC order
                 if (biasMode == KernelBiasModePerFilter) {
@@ -1061,7 +1032,7 @@ void Convolution2DKernelImpl1B2B(ExecutionKernelConfig<ConvolutionConfig2D> cons
                     }
                 }
 
-                O[OH * outWidth * numFilters + OW * numFilters + OD] = (int32_t)outVal;
+                O[(OH - firstOutputRow) * outWidth * numFilters + OW * numFilters + OD] = (int32_t)outVal;
             }
         }
     }
@@ -1086,7 +1057,6 @@ void Convolution2DKernelImpl2B1B(ExecutionKernelConfig<ConvolutionConfig2D> cons
 
     auto biasMode = config->RequestConfig->Transform.BiasMode;
 
-    uint32_t inputHeightWPad = inputHeight + 2 * padHeight;
     uint32_t inputWidthWPad = inputWidth + 2 * padWidth;
     uint32_t inWidthMax = inputWidth + padWidth - 1;
     uint32_t inHeightMax = inputHeight + padHeight - 1;
@@ -1099,14 +1069,15 @@ void Convolution2DKernelImpl2B1B(ExecutionKernelConfig<ConvolutionConfig2D> cons
     const void* biasData = config->RequestConfig->Transform.BiasData;
 
     uint32_t outWidth = 1 + ((inputWidthWPad - filterWidth) / strideWidth);
-    uint32_t outHeight = 1 + ((inputHeightWPad - filterHeight) / strideHeight);
+    uint32_t firstOutputRow = config->RequestConfig->Transform.FirstOutputRow;
+    uint32_t outHeight = firstOutputRow + config->RequestConfig->Transform.OutputRowCount;
 
     for (uint32_t OD = 0; OD < numFilters; OD++) { //Output depth or #filters
 
         uint32_t fIdxN = (OD * (inputDepth * filterWidth * filterHeight + filterPadding));
 
         for (uint32_t OW = 0; OW < outWidth; OW++) { //Output width
-            for (uint32_t OH = 0; OH < outHeight; OH++) {    //Output height
+            for (uint32_t OH = firstOutputRow; OH < outHeight; OH++) {    //Output height
 
                 int64_t outVal;// = &O[OH * outWidth * numFilters + OW * numFilters + OD]; //NHWC order
                 if (biasMode == KernelBiasModePerFilter) {
@@ -1141,7 +1112,7 @@ void Convolution2DKernelImpl2B1B(ExecutionKernelConfig<ConvolutionConfig2D> cons
                     }
                 }
 
-                O[OH * outWidth * numFilters + OW * numFilters + OD] = (int32_t)outVal;
+                O[(OH - firstOutputRow) * outWidth * numFilters + OW * numFilters + OD] = (int32_t)outVal;
             }
         }
     }
@@ -1167,7 +1138,6 @@ void Convolution2DKernelImpl2B2B(ExecutionKernelConfig<ConvolutionConfig2D> cons
 
     auto biasMode = config->RequestConfig->Transform.BiasMode;
 
-    uint32_t inputHeightWPad = inputHeight + 2 * padHeight;
     uint32_t inputWidthWPad = inputWidth + 2 * padWidth;
     uint32_t inWidthMax = inputWidth + padWidth - 1;
     uint32_t inHeightMax = inputHeight + padHeight - 1;
@@ -1180,14 +1150,15 @@ void Convolution2DKernelImpl2B2B(ExecutionKernelConfig<ConvolutionConfig2D> cons
     const void* biasData = config->RequestConfig->Transform.BiasData;
 
     uint32_t outWidth = 1 + ((inputWidthWPad - filterWidth) / strideWidth);
-    uint32_t outHeight = 1 + ((inputHeightWPad - filterHeight) / strideHeight);
+    uint32_t firstOutputRow = config->RequestConfig->Transform.FirstOutputRow;
+    uint32_t outHeight = firstOutputRow + config->RequestConfig->Transform.OutputRowCount;
 
     for (uint32_t OD = 0; OD < numFilters; OD++) { // Output depth
 
         uint32_t fIdxN = (OD * (inputDepth * filterWidth * filterHeight + filterPadding));
 
         for (uint32_t OW = 0; OW < outWidth; OW++) {
-            for (uint32_t OH = 0; OH < outHeight; OH++) {
+            for (uint32_t OH = firstOutputRow; OH < outHeight; OH++) {
 
                 int64_t outVal;// = &O[OH * outWidth * numFilters + OW * numFilters + OD]; //NHWC order
                 if (biasMode == KernelBiasModePerFilter) {
@@ -1222,7 +1193,7 @@ void Convolution2DKernelImpl2B2B(ExecutionKernelConfig<ConvolutionConfig2D> cons
                     }
                 }
 
-                O[OH * outWidth * numFilters + OW * numFilters + OD] = (int32_t)outVal;
+                O[(OH - firstOutputRow) * outWidth * numFilters + OW * numFilters + OD] = (int32_t)outVal;
             }
         }
     }
@@ -251,7 +251,7 @@ void ConvolutionPoolingKernelImpl(ConvolutionConfig const * const filterConfig,
         return;
     }
 
-    pwl->KERNEL(InitializeActivationFunctions)();
+    auto const activateSingle = pwl->KERNEL(GetActivationFunctions)().ActivateSingle;
 
     void(*func_partial_pooling)(const uint32_t PS, const uint32_t pool_num_entries, const uint32_t pool_start_index, const int64_t *P, int64_t *V);
 
@@ -653,7 +653,7 @@ void ConvolutionPoolingKernelImpl(ConvolutionConfig const * const filterConfig,
                 {
                     func_partial_pooling(PS, PS, 0, pool + i * CNN_POOL_SIZE_MAX, &value);
                     gna_saturate_cast(value, *saturationCount);
-                    pwl->ActivateSingle(&pwl->pwl, (int32_t)value, &O[output_index * FN + i], saturationCount);
+                    activateSingle(&pwl->pwl, (int32_t)value, &O[output_index * FN + i], saturationCount);
                 }
 
                 pool_start_index = (pool_start_index + PSTEP) % PS;
@@ -680,7 +680,7 @@ void ConvolutionPoolingKernelImpl(ConvolutionConfig const * const filterConfig,
             func_partial_pooling(PS, static_cast<uint32_t>(pool_num_entries), pool_start_index, pool + i * CNN_POOL_SIZE_MAX, &value);
             gna_saturate_cast(value, *saturationCount);
 
-            pwl->ActivateSingle(&pwl->pwl, (int32_t)value, &O[output_index * FN + i], saturationCount);
+            activateSingle(&pwl->pwl, (int32_t)value, &O[output_index * FN + i], saturationCount);
         }
 
         pool_start_index = (pool_start_index + PSTEP) % PS;
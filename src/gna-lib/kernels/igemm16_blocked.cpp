@@ -0,0 +1,233 @@
+/**
+ @copyright (C) 2021 Intel Corporation
+ SPDX-License-Identifier: LGPL-2.1-or-later
+ */
+
+// AVX2 affine kernels for 2B inputs blocked for layers with inputs not fitting L2 cache.
+// Input elements are split into K blocks, whose deinterleaved inputs stay in L1 cache
+// while multiplied by weights of every row of M block,
+// whose 32-bit partial outputs stay in L1 cache until all K blocks are accumulated.
+// Thus only weights are streamed from memory.
+// Partial sums are accumulated in unsigned arithmetic, thus wrap on int32 overflow
+// as SIMD lanes of unblocked fast kernels do, so that results are identical to unblocked kernels.
+
+#include "igemv16.h"
+#include "igemv8.h"
+
+#include "KernelArguments.h"
+#include "KernelMacros.h"
+
+#include "common.h"
+#include "gna-api-types-xnn.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <immintrin.h>
+
+namespace
+{
+
+// Blocking pays off only for inputs not staying in L2 cache (256KB on most AVX2 processors)
+// next to streamed weights, as it breaks sequential access to weights
+constexpr uint32_t blockedInputsSizeMin = 128 * 1024;
+// Deinterleaved inputs of K block stay in L1 cache together with partial outputs of M block
+constexpr uint32_t inputBlockSize = 32 * 1024;
+constexpr uint32_t outputBlockSize = 2 * 1024;
+
+constexpr uint32_t vectorElementCount = 16;
+
+__forceinline __m256i load(int16_t const * const elements)
+{
+    return _mm256_loadu_si256(reinterpret_cast<__m256i const *>(elements));
+}
+
+__forceinline __m256i load(int8_t const * const elements)
+{
+    return _mm256_cvtepi8_epi16(_mm_loadu_si128(reinterpret_cast<__m128i const *>(elements)));
+}
+
+// Sums 32-bit lanes, wrapping on overflow
+__forceinline uint32_t sumLanes(__m256i const acc)
+{
+    auto sum = _mm_add_epi32(_mm256_castsi256_si128(acc), _mm256_extracti128_si256(acc, 1));
+    sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, _MM_SHUFFLE(1, 0, 3, 2)));
+    sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, _MM_SHUFFLE(2, 3, 0, 1)));
+    return static_cast<uint32_t>(_mm_cvtsi128_si32(sum));
+}
+
+__forceinline int32_t wrappingAdd(int32_t const a, uint32_t const b)
+{
+    return static_cast<int32_t>(static_cast<uint32_t>(a) + b);
+}
+
+// Adds products of elementCount weights of each of rowCount rows
+// and elements of VectorCount vectors to partial outputs
+template<uint32_t VectorCount, typename WeightType>
+void multiplyBlock(WeightType const * weights, uint32_t const weightsRowStride, uint32_t const rowCount,
+    int16_t const * const * const vectors, uint32_t const elementCount, int32_t * outputs)
+{
+    auto const simdElementCount = elementCount - elementCount % vectorElementCount;
+    for (uint32_t row = 0; row < rowCount; row++, weights += weightsRowStride, outputs += VectorCount)
+    {
+        __m256i acc[VectorCount];
+        for (uint32_t v = 0; v < VectorCount; v++)
+        {
+            acc[v] = _mm256_setzero_si256();
+        }
+        for (uint32_t e = 0; e < simdElementCount; e += vectorElementCount)
+        {
+            auto const w = load(weights + e);
+            for (uint32_t v = 0; v < VectorCount; v++)
+            {
+                acc[v] = _mm256_add_epi32(acc[v], _mm256_madd_epi16(load(vectors[v] + e), w));
+            }
+        }
+        for (uint32_t v = 0; v < VectorCount; v++)
+        {
+            auto sum = sumLanes(acc[v]);
+            for (uint32_t e = simdElementCount; e < elementCount; e++)
+            {
+                sum += static_cast<uint32_t>(weights[e] * vectors[v][e]);
+            }
+            outputs[v] = wrappingAdd(outputs[v], sum);
+        }
+    }
+}
+
+template<typename WeightType>
+void multiplyBlock(WeightType const * const weights, uint32_t const weightsRowStride, uint32_t const rowCount,
+    int16_t const * const * const vectors, uint32_t const vectorCount, uint32_t const elementCount,
+    int32_t * const outputs)
+{
+    switch (vectorCount)
+    {
+    case 1:
+        return multiplyBlock<1>(weights, weightsRowStride, rowCount, vectors, elementCount, outputs);
+    case 2:
+        return multiplyBlock<2>(weights, weightsRowStride, rowCount, vectors, elementCount, outputs);
+    case 3:
+        return multiplyBlock<3>(weights, weightsRowStride, rowCount, vectors, elementCount, outputs);
+    case 4:
+        return multiplyBlock<4>(weights, weightsRowStride, rowCount, vectors, elementCount, outputs);
+    case 5:
+        return multiplyBlock<5>(weights, weightsRowStride, rowCount, vectors, elementCount, outputs);
+    case 6:
+        return multiplyBlock<6>(weights, weightsRowStride, rowCount, vectors, elementCount, outputs);
+    case 7:
+        return multiplyBlock<7>(weights, weightsRowStride, rowCount, vectors, elementCount, outputs);
+    default:
+        return multiplyBlock<8>(weights, weightsRowStride, rowCount, vectors, elementCount, outputs);
+    }
+}
+
+bool isBlocked(AffineConfig const & transform)
+{
+    return transform.inputVectorCount * transform.inputElementCount * sizeof(int16_t) > blockedInputsSizeMin;
+}
+
+// Computes outputs in M blocks of K blocks,
+// outputs of M block are initialized before and finalized after all K blocks are accumulated
+template<typename WeightType, typename Initialize, typename Finalize>
+void computeBlocked(ExecutionKernelConfig<AffineConfig> const * const config, WeightType const * const weights,
+    Initialize initialize, Finalize finalize)
+{
+    auto const & transform = config->RequestConfig->Transform;
+    auto const vectorCount = transform.inputVectorCount;
+    auto const elementCount = transform.inputElementCount;
+    auto const rowCount = transform.outputElementCount;
+    auto const * const inputs = reinterpret_cast<int16_t const *>(config->RequestConfig->Inputs);
+    auto * const outputs = reinterpret_cast<int32_t *>(config->RequestConfig->Outputs);
+
+    int16_t * const buffers[XNN_N_GROUP_MAX] = { config->Intermediate->d0, config->Intermediate->d1,
+        config->Intermediate->d2, config->Intermediate->d3, config->Intermediate->d4,
+        config->Intermediate->d5, config->Intermediate->d6, config->Intermediate->d7 };
+    int16_t const * vectors[XNN_N_GROUP_MAX] = { inputs };
+    if (vectorCount > 1)
+    {
+        for (uint32_t v = 0; v < vectorCount; v++)
+        {
+            for (uint32_t k = 0; k < elementCount; k++)
+            {
+                buffers[v][k] = inputs[k * vectorCount + v];
+            }
+            vectors[v] = buffers[v];
+        }
+    }
+
+    // K blocks of even size, so that last block is not much smaller than others
+    auto const inputsSize = vectorCount * elementCount * static_cast<uint32_t>(sizeof(int16_t));
+    auto const blockCount = (inputsSize + inputBlockSize - 1) / inputBlockSize;
+    auto const blockElementCount = RoundUp((elementCount + blockCount - 1) / blockCount, vectorElementCount);
+    auto const blockRowCount = (std::max)(1u,
+        static_cast<uint32_t>(outputBlockSize / (vectorCount * sizeof(int32_t))));
+    int16_t const * blockVectors[XNN_N_GROUP_MAX];
+    for (uint32_t row = 0; row < rowCount; row += blockRowCount)
+    {
+        auto const blockRows = (std::min)(blockRowCount, rowCount - row);
+        auto * const blockOutputs = outputs + row * vectorCount;
+        initialize(row, blockRows, blockOutputs);
+        for (uint32_t element = 0; element < elementCount; element += blockElementCount)
+        {
+            for (uint32_t v = 0; v < vectorCount; v++)
+            {
+                blockVectors[v] = vectors[v] + element;
+            }
+            multiplyBlock(weights + uint64_t{ row } * elementCount + element, elementCount, blockRows,
+                blockVectors, vectorCount, (std::min)(blockElementCount, elementCount - element), blockOutputs);
+        }
+        finalize(row, blockRows, blockOutputs);
+    }
+}
+
+}
+
+void AffineBlockedKernelImpl2B(ExecutionKernelConfig<AffineConfig> const * const config)
+{
+    auto const & transform = config->RequestConfig->Transform;
+    if (!isBlocked(transform))
+    {
+        AffineKernelImpl2B(config);
+        return;
+    }
+
+    auto const vectorCount = transform.inputVectorCount;
+    computeBlocked(config, transform.weights2B,
+        [&](uint32_t firstRow, uint32_t rowCount, int32_t * outputs)
+        {
+            for (uint32_t r = 0; r < rowCount; r++)
+            {
+                std::fill_n(outputs + r * vectorCount, vectorCount,
+                    getBias(transform.biasesSimple, transform.bytesPerBias, firstRow + r));
+            }
+        },
+        [](uint32_t, uint32_t, int32_t *) {});
+}
+
+void AffineBlockedKernelImpl1B(ExecutionKernelConfig<AffineConfig> const * const config)
+{
+    auto const & transform = config->RequestConfig->Transform;
+    if (!isBlocked(transform))
+    {
+        AffineKernelImpl1B(config);
+        return;
+    }
+
+    auto const vectorCount = transform.inputVectorCount;
+    computeBlocked(config, transform.weights1B,
+        [&](uint32_t, uint32_t rowCount, int32_t * outputs)
+        {
+            std::fill_n(outputs, rowCount * vectorCount, 0);
+        },
+        [&](uint32_t firstRow, uint32_t rowCount, int32_t * outputs)
+        {
+            for (uint32_t r = 0; r < rowCount; r++)
+            {
+                auto const & bias = transform.biasesCompound[firstRow + r];
+                for (uint32_t v = 0; v < vectorCount; v++)
+                {
+                    auto & output = outputs[r * vectorCount + v];
+                    output = wrappingAdd(bias.bias, static_cast<uint32_t>(output) * bias.multiplier);
+                }
+            }
+        });
+}
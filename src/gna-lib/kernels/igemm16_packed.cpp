@@ -0,0 +1,164 @@
+/**
+ @copyright (C) 2021 Intel Corporation
+ SPDX-License-Identifier: LGPL-2.1-or-later
+ */
+
+// Affine kernel for 2B inputs and 2B weights repacked by the library, see AffinePackedLayout.
+// Each panel of rows is multiplied by every input vector while it stays in L1 cache,
+// using one accumulator per panel row and aligned weight loads,
+// so that horizontal sums are done once per panel instead of once per row.
+// SSE4 and AVX1 use 128-bit integer vectors, AVX2 uses 256-bit ones.
+
+#include "igemv16.h"
+
+#include "KernelArguments.h"
+#include "KernelMacros.h"
+
+#include "gna-api-types-xnn.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <immintrin.h>
+
+namespace
+{
+
+using Layout = AffinePackedLayout;
+
+// Stores sums of input vector and each row of panel in sums
+#if OPT_LEVEL > 5
+__forceinline void sumPanel(int16_t const * const weights, int16_t const * const input,
+    uint32_t const chunkCount, int32_t * const sums)
+{
+    auto acc0 = _mm256_setzero_si256();
+    auto acc1 = _mm256_setzero_si256();
+    auto acc2 = _mm256_setzero_si256();
+    auto acc3 = _mm256_setzero_si256();
+    auto acc4 = _mm256_setzero_si256();
+    auto acc5 = _mm256_setzero_si256();
+    auto acc6 = _mm256_setzero_si256();
+    auto acc7 = _mm256_setzero_si256();
+    auto const * w = reinterpret_cast<__m256i const *>(weights);
+    auto const * const in = reinterpret_cast<__m256i const *>(input);
+    for (uint32_t chunk = 0; chunk < chunkCount; chunk++, w += Layout::RowCount)
+    {
+        auto const x = _mm256_load_si256(in + chunk);
+        acc0 = _mm256_add_epi32(acc0, _mm256_madd_epi16(x, _mm256_load_si256(w)));
+        acc1 = _mm256_add_epi32(acc1, _mm256_madd_epi16(x, _mm256_load_si256(w + 1)));
+        acc2 = _mm256_add_epi32(acc2, _mm256_madd_epi16(x, _mm256_load_si256(w + 2)));
+        acc3 = _mm256_add_epi32(acc3, _mm256_madd_epi16(x, _mm256_load_si256(w + 3)));
+        acc4 = _mm256_add_epi32(acc4, _mm256_madd_epi16(x, _mm256_load_si256(w + 4)));
+        acc5 = _mm256_add_epi32(acc5, _mm256_madd_epi16(x, _mm256_load_si256(w + 5)));
+        acc6 = _mm256_add_epi32(acc6, _mm256_madd_epi16(x, _mm256_load_si256(w + 6)));
+        acc7 = _mm256_add_epi32(acc7, _mm256_madd_epi16(x, _mm256_load_si256(w + 7)));
+    }
+
+    // lanes of sum0123 are partial sums of rows 0-3, of sum4567 of rows 4-7
+    auto const sum0123 = _mm256_hadd_epi32(_mm256_hadd_epi32(acc0, acc1), _mm256_hadd_epi32(acc2, acc3));
+    auto const sum4567 = _mm256_hadd_epi32(_mm256_hadd_epi32(acc4, acc5), _mm256_hadd_epi32(acc6, acc7));
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(sums), _mm256_add_epi32(
+        _mm256_permute2x128_si256(sum0123, sum4567, 0x20),
+        _mm256_permute2x128_si256(sum0123, sum4567, 0x31)));
+}
+#elif OPT_LEVEL > 1
+__forceinline __m128i maddChunk(__m128i const x0, __m128i const x1, __m128i const * const w)
+{
+    return _mm_add_epi32(_mm_madd_epi16(x0, _mm_load_si128(w)), _mm_madd_epi16(x1, _mm_load_si128(w + 1)));
+}
+
+__forceinline void sumPanel(int16_t const * const weights, int16_t const * const input,
+    uint32_t const chunkCount, int32_t * const sums)
+{
+    auto acc0 = _mm_setzero_si128();
+    auto acc1 = _mm_setzero_si128();
+    auto acc2 = _mm_setzero_si128();
+    auto acc3 = _mm_setzero_si128();
+    auto acc4 = _mm_setzero_si128();
+    auto acc5 = _mm_setzero_si128();
+    auto acc6 = _mm_setzero_si128();
+    auto acc7 = _mm_setzero_si128();
+    auto const * w = reinterpret_cast<__m128i const *>(weights);
+    auto const * in = reinterpret_cast<__m128i const *>(input);
+    for (uint32_t chunk = 0; chunk < chunkCount; chunk++, w += 2 * Layout::RowCount, in += 2)
+    {
+        auto const x0 = _mm_load_si128(in);
+        auto const x1 = _mm_load_si128(in + 1);
+        acc0 = _mm_add_epi32(acc0, maddChunk(x0, x1, w));
+        acc1 = _mm_add_epi32(acc1, maddChunk(x0, x1, w + 2));
+        acc2 = _mm_add_epi32(acc2, maddChunk(x0, x1, w + 4));
+        acc3 = _mm_add_epi32(acc3, maddChunk(x0, x1, w + 6));
+        acc4 = _mm_add_epi32(acc4, maddChunk(x0, x1, w + 8));
+        acc5 = _mm_add_epi32(acc5, maddChunk(x0, x1, w + 10));
+        acc6 = _mm_add_epi32(acc6, maddChunk(x0, x1, w + 12));
+        acc7 = _mm_add_epi32(acc7, maddChunk(x0, x1, w + 14));
+    }
+
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(sums),
+        _mm_hadd_epi32(_mm_hadd_epi32(acc0, acc1), _mm_hadd_epi32(acc2, acc3)));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(sums) + 1,
+        _mm_hadd_epi32(_mm_hadd_epi32(acc4, acc5), _mm_hadd_epi32(acc6, acc7)));
+}
+#else
+void sumPanel(int16_t const * weights, int16_t const * const input,
+    uint32_t const chunkCount, int32_t * const sums)
+{
+    std::fill_n(sums, Layout::RowCount, 0);
+    for (uint32_t chunk = 0; chunk < chunkCount; chunk++)
+    {
+        auto const * const x = input + chunk * Layout::ElementCount;
+        for (uint32_t r = 0; r < Layout::RowCount; r++, weights += Layout::ElementCount)
+        {
+            for (uint32_t e = 0; e < Layout::ElementCount; e++)
+            {
+                sums[r] += weights[e] * x[e];
+            }
+        }
+    }
+}
+#endif
+
+}
+
+void AffinePackedKernelImpl2B(ExecutionKernelConfig<AffineConfig> const * const config)
+{
+    auto const & transform = config->RequestConfig->Transform;
+    auto const vectorCount = transform.inputVectorCount;
+    auto const elementCount = transform.inputElementCount;
+    auto const chunkCount = Layout::GetChunkCount(elementCount);
+    auto const paddedCount = chunkCount * Layout::ElementCount;
+
+    // input vectors are deinterleaved and zero padded to whole chunks
+    int16_t * const vectors[XNN_N_GROUP_MAX] = { config->Intermediate->d0, config->Intermediate->d1,
+        config->Intermediate->d2, config->Intermediate->d3, config->Intermediate->d4,
+        config->Intermediate->d5, config->Intermediate->d6, config->Intermediate->d7 };
+    auto const * const inputs = reinterpret_cast<int16_t const *>(config->RequestConfig->Inputs);
+    for (uint32_t v = 0; v < vectorCount; v++)
+    {
+        auto * const vector = vectors[v];
+        for (uint32_t k = 0; k < elementCount; k++)
+        {
+            vector[k] = inputs[k * vectorCount + v];
+        }
+        std::fill(vector + elementCount, vector + paddedCount, int16_t{ 0 });
+    }
+
+    auto const * weights = transform.weights2B;
+    auto const * const biases = reinterpret_cast<int32_t const *>(transform.biasesSimple);
+    auto * const outputs = reinterpret_cast<int32_t *>(config->RequestConfig->Outputs);
+    uint32_t const panelRowCount = Layout::RowCount;
+    int32_t sums[Layout::RowCount];
+    for (uint32_t row = 0; row < transform.outputElementCount; row += panelRowCount)
+    {
+        auto const rowCount = (std::min)(panelRowCount, transform.outputElementCount - row);
+        for (uint32_t v = 0; v < vectorCount; v++)
+        {
+            sumPanel(weights, vectors[v], chunkCount, sums);
+            for (uint32_t r = 0; r < rowCount; r++)
+            {
+                outputs[(row + r) * vectorCount + v] = sums[r] + biases[row + r];
+            }
+        }
+        weights += panelRowCount * paddedCount;
+    }
+}
@@ -0,0 +1,489 @@
+/**
+ @copyright (C) 2021 Intel Corporation
+ SPDX-License-Identifier: LGPL-2.1-or-later
+ */
+
+// Affine, active list, multibias and diagonal kernels for 1B (GNA_INT8) inputs
+// with 1B or 2B weights.
+// 1B inputs are sign extended to 16 bits while being deinterleaved to KernelBuffers,
+// so both weight widths share the same madd based dot product.
+// SSE4 and AVX1 use 128-bit integer vectors, AVX2 uses 256-bit ones.
+
+#include "igemv.h"
+#include "igemv8.h"
+#include "igemv16.h"
+
+#include "KernelArguments.h"
+#include "KernelMacros.h"
+
+#include "common.h"
+#include "gna-api-types-xnn.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <immintrin.h>
+
+namespace
+{
+
+#if OPT_LEVEL > 5
+constexpr uint32_t VEC_1B_CAP = 16;
+constexpr uint32_t VEC_32CAP = 8;
+
+__forceinline mm_vector loadInput(int16_t const * const input)
+{
+    return _mm256_loadu_si256((__m256i const *)input);
+}
+
+__forceinline mm_vector loadWeights(int8_t const * const weight)
+{
+    return _mm256_cvtepi8_epi16(_mm_loadu_si128((__m128i const *)weight));
+}
+
+__forceinline mm_vector loadWeights(int16_t const * const weight)
+{
+    return _mm256_loadu_si256((__m256i const *)weight);
+}
+
+__forceinline mm_vector madd(mm_vector const input, mm_vector const weight)
+{
+    return _mm256_madd_epi16(input, weight);
+}
+
+__forceinline void widen(int8_t const * const input, int16_t * const output)
+{
+    _mm256_storeu_si256((__m256i *)output,
+        _mm256_cvtepi8_epi16(_mm_loadu_si128((__m128i const *)input)));
+}
+
+#if GNA_SAT
+__forceinline mm_vector accumulate(mm_vector const acc, mm_vector const x)
+{
+    return _mm256_add_epi64(acc, _mm256_add_epi64(
+        _mm256_cvtepi32_epi64(_mm256_castsi256_si128(x)),
+        _mm256_cvtepi32_epi64(_mm256_extracti128_si256(x, 1))));
+}
+
+__forceinline int64_t horizontalSum(mm_vector const acc)
+{
+    __m128i s = _mm_add_epi64(_mm256_castsi256_si128(acc), _mm256_extracti128_si256(acc, 1));
+    return _mm_extract_epi64(s, 0) + _mm_extract_epi64(s, 1);
+}
+#else
+__forceinline mm_vector accumulate(mm_vector const acc, mm_vector const x)
+{
+    return _mm256_add_epi32(acc, x);
+}
+
+__forceinline int32_t horizontalSum(mm_vector const acc)
+{
+    __m128i s = _mm_add_epi32(_mm256_castsi256_si128(acc), _mm256_extracti128_si256(acc, 1));
+    s = _mm_hadd_epi32(s, s);
+    s = _mm_hadd_epi32(s, s);
+    return _mm_cvtsi128_si32(s);
+}
+#endif
+
+#else // SSE4 & AVX1
+constexpr uint32_t VEC_1B_CAP = 8;
+constexpr uint32_t VEC_32CAP = 4;
+
+__forceinline mm_vector loadInput(int16_t const * const input)
+{
+    return _mm_loadu_si128((__m128i const *)input);
+}
+
+__forceinline mm_vector loadWeights(int8_t const * const weight)
+{
+    return _mm_cvtepi8_epi16(_mm_loadl_epi64((__m128i const *)weight));
+}
+
+__forceinline mm_vector loadWeights(int16_t const * const weight)
+{
+    return _mm_loadu_si128((__m128i const *)weight);
+}
+
+__forceinline mm_vector madd(mm_vector const input, mm_vector const weight)
+{
+    return _mm_madd_epi16(input, weight);
+}
+
+__forceinline void widen(int8_t const * const input, int16_t * const output)
+{
+    _mm_storeu_si128((__m128i *)output, _mm_cvtepi8_epi16(_mm_loadl_epi64((__m128i const *)input)));
+}
+
+#if GNA_SAT
+__forceinline mm_vector accumulate(mm_vector const acc, mm_vector const x)
+{
+    return _mm_add_epi64(acc, _mm_add_epi64(
+        _mm_cvtepi32_epi64(x), _mm_cvtepi32_epi64(_mm_srli_si128(x, 8))));
+}
+
+__forceinline int64_t horizontalSum(mm_vector const acc)
+{
+    return _mm_extract_epi64(acc, 0) + _mm_extract_epi64(acc, 1);
+}
+#else
+__forceinline mm_vector accumulate(mm_vector const acc, mm_vector const x)
+{
+    return _mm_add_epi32(acc, x);
+}
+
+__forceinline int32_t horizontalSum(mm_vector const acc)
+{
+    __m128i s = _mm_hadd_epi32(acc, acc);
+    s = _mm_hadd_epi32(s, s);
+    return _mm_cvtsi128_si32(s);
+}
+#endif
+#endif
+
+// Sign extends and deinterleaves [K;N] 1B inputs to N flat 2B vectors in KernelBuffers
+void deinterleave(int8_t const * const inputs, uint32_t const K, uint32_t const N,
+    KernelBuffers * const buffers, int16_t const * in[XNN_N_GROUP_MAX])
+{
+    int16_t * const d[XNN_N_GROUP_MAX] = { buffers->d0, buffers->d1, buffers->d2, buffers->d3,
+        buffers->d4, buffers->d5, buffers->d6, buffers->d7 };
+    uint32_t k = 0;
+
+    if (1 == N)
+    {
+        for (; k + VEC_1B_CAP <= K; k += VEC_1B_CAP)
+        {
+            widen(inputs + k, d[0] + k);
+        }
+        for (; k < K; k++)
+        {
+            d[0][k] = inputs[k];
+        }
+    }
+    else
+    {
+        for (; k < K; k++)
+        {
+            for (uint32_t j = 0; j < N; j++)
+            {
+                d[j][k] = inputs[k * N + j];
+            }
+        }
+    }
+    for (uint32_t j = 0; j < N; j++)
+    {
+        in[j] = d[j];
+    }
+}
+
+// Adds dot products of weight row elements [kBegin, kEnd) and N input vectors to sums
+template<uint32_t N, typename WeightType>
+__forceinline void dotProducts(WeightType const * const weight, int16_t const * const in[XNN_N_GROUP_MAX],
+    uint32_t const kBegin, uint32_t const kEnd, gna_sum_t sums[N])
+{
+    mm_vector acc[N];
+    mm_vector w;
+    uint32_t j;
+    uint32_t k = kBegin;
+
+    for (j = 0; j < N; j++)
+    {
+        acc[j] = vec_setzero();
+    }
+    for (; k + VEC_1B_CAP <= kEnd; k += VEC_1B_CAP)
+    {
+        w = loadWeights(weight + k);
+        for (j = 0; j < N; j++)
+        {
+            acc[j] = accumulate(acc[j], madd(loadInput(in[j] + k), w));
+        }
+    }
+    for (j = 0; j < N; j++)
+    {
+        sums[j] += horizontalSum(acc[j]);
+    }
+    for (; k < kEnd; k++)
+    {
+        for (j = 0; j < N; j++)
+        {
+            sums[j] += weight[k] * in[j][k];
+        }
+    }
+}
+
+// Computes outputs for rows given by indices (or all rows when indices are null),
+// biases for row i are read at biases[i * biasStride]
+template<uint32_t N, typename WeightType>
+void affineRows(ExecutionKernelConfig<AffineConfig> const * const config, WeightType const * const weights,
+    void const * const biases, uint32_t const biasStride, uint32_t const * const indices, uint32_t const rowCount,
+    int16_t const * const in[XNN_N_GROUP_MAX])
+{
+    auto const K = config->RequestConfig->Transform.inputElementCount;
+    auto const bytesPerBias = config->RequestConfig->Transform.bytesPerBias;
+    auto * output = reinterpret_cast<int32_t *>(config->RequestConfig->Outputs);
+    gna_sum_t sums[N];
+    uint32_t i;
+    uint32_t j;
+
+#if GNA_SAT
+    const uint32_t kpartial = config->BufferElementCount[N - 1] / N;
+#endif
+
+    for (uint32_t r = 0; r < rowCount; r++)
+    {
+        i = (nullptr != indices) ? indices[r] : r;
+        for (j = 0; j < N; j++)
+        {
+            sums[j] = getBias(biases, bytesPerBias, i * biasStride);
+        }
+#if GNA_SAT
+        for (uint32_t kk = 0; kk < K; kk += kpartial)
+        {
+            dotProducts<N>(weights + i * K, in, kk, std::min(kk + kpartial, K), sums);
+            for (j = 0; j < N; j++)
+            {
+                saturate(&sums[j], config->SaturationCount);
+            }
+        }
+#else
+        dotProducts<N>(weights + i * K, in, 0, K, sums);
+#endif
+        for (j = 0; j < N; j++)
+        {
+            *output++ = (int32_t)sums[j];
+        }
+    }
+}
+
+template<typename WeightType>
+void affine(ExecutionKernelConfig<AffineConfig> const * const config, WeightType const * const weights,
+    void const * const biases, uint32_t const biasStride, uint32_t const * const indices, uint32_t const rowCount)
+{
+    auto const N = config->RequestConfig->Transform.inputVectorCount;
+    int16_t const * in[XNN_N_GROUP_MAX];
+
+    deinterleave(config->RequestConfig->Inputs, config->RequestConfig->Transform.inputElementCount,
+        N, config->Intermediate, in);
+
+    switch (N)
+    {
+    case 1:
+        affineRows<1>(config, weights, biases, biasStride, indices, rowCount, in);
+        break;
+    case 2:
+        affineRows<2>(config, weights, biases, biasStride, indices, rowCount, in);
+        break;
+    case 3:
+        affineRows<3>(config, weights, biases, biasStride, indices, rowCount, in);
+        break;
+    case 4:
+        affineRows<4>(config, weights, biases, biasStride, indices, rowCount, in);
+        break;
+    case 5:
+        affineRows<5>(config, weights, biases, biasStride, indices, rowCount, in);
+        break;
+    case 6:
+        affineRows<6>(config, weights, biases, biasStride, indices, rowCount, in);
+        break;
+    case 7:
+        affineRows<7>(config, weights, biases, biasStride, indices, rowCount, in);
+        break;
+    case 8:
+        affineRows<8>(config, weights, biases, biasStride, indices, rowCount, in);
+        break;
+    default:
+        break;
+    }
+}
+
+#if OPT_LEVEL > 5
+typedef __m256i mm_vector32;
+
+__forceinline mm_vector32 load32(int8_t const * const data)
+{
+    return _mm256_cvtepi8_epi32(_mm_loadl_epi64((__m128i const *)data));
+}
+
+__forceinline mm_vector32 load32(int16_t const * const data)
+{
+    return _mm256_cvtepi16_epi32(_mm_loadu_si128((__m128i const *)data));
+}
+
+__forceinline mm_vector32 load32(int32_t const * const data)
+{
+    return _mm256_loadu_si256((__m256i const *)data);
+}
+
+__forceinline mm_vector32 set32(int32_t const value)
+{
+    return _mm256_set1_epi32(value);
+}
+
+// Returns bias + weight * input saturated to int32, counts saturated elements
+__forceinline void storeSaturated(mm_vector32 const bias, mm_vector32 const weight, mm_vector32 const input,
+    int32_t * const output, uint32_t * const saturationCount)
+{
+    auto const product = _mm256_mullo_epi32(weight, input);
+    auto const result = _mm256_add_epi32(bias, product);
+    auto const overflow = _mm256_and_si256(_mm256_xor_si256(result, bias), _mm256_xor_si256(result, product));
+    auto const limit = _mm256_xor_si256(_mm256_srai_epi32(product, 31), _mm256_set1_epi32(INT32_MAX));
+    _mm256_storeu_si256((__m256i *)output,
+        _mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(result),
+            _mm256_castsi256_ps(limit), _mm256_castsi256_ps(overflow))));
+    for (auto mask = (uint32_t)_mm256_movemask_ps(_mm256_castsi256_ps(overflow)); mask != 0; mask &= mask - 1)
+    {
+        (*saturationCount)++;
+    }
+}
+#else
+typedef __m128i mm_vector32;
+
+__forceinline mm_vector32 load32(int8_t const * const data)
+{
+    int32_t packed;
+    memcpy(&packed, data, sizeof(packed));
+    return _mm_cvtepi8_epi32(_mm_cvtsi32_si128(packed));
+}
+
+__forceinline mm_vector32 load32(int16_t const * const data)
+{
+    return _mm_cvtepi16_epi32(_mm_loadl_epi64((__m128i const *)data));
+}
+
+__forceinline mm_vector32 load32(int32_t const * const data)
+{
+    return _mm_loadu_si128((__m128i const *)data);
+}
+
+__forceinline mm_vector32 set32(int32_t const value)
+{
+    return _mm_set1_epi32(value);
+}
+
+__forceinline void storeSaturated(mm_vector32 const bias, mm_vector32 const weight, mm_vector32 const input,
+    int32_t * const output, uint32_t * const saturationCount)
+{
+    auto const product = _mm_mullo_epi32(weight, input);
+    auto const result = _mm_add_epi32(bias, product);
+    auto const overflow = _mm_and_si128(_mm_xor_si128(result, bias), _mm_xor_si128(result, product));
+    auto const limit = _mm_xor_si128(_mm_srai_epi32(product, 31), _mm_set1_epi32(INT32_MAX));
+    _mm_storeu_si128((__m128i *)output, _mm_blendv_epi8(result, limit, _mm_srai_epi32(overflow, 31)));
+    for (auto mask = (uint32_t)_mm_movemask_ps(_mm_castsi128_ps(overflow)); mask != 0; mask &= mask - 1)
+    {
+        (*saturationCount)++;
+    }
+}
+#endif
+
+// Diagonal transform is always saturated, as in generic kernels
+template<typename WeightType, typename BiasType>
+void diagonal(ExecutionKernelConfig<AffineConfig> const * const config, WeightType const * const weight,
+    BiasType const * const bias)
+{
+    auto const M = config->RequestConfig->Transform.outputElementCount;
+    auto const N = config->RequestConfig->Transform.inputVectorCount;
+    auto const * const input = config->RequestConfig->Inputs;
+    auto * const output = reinterpret_cast<int32_t *>(config->RequestConfig->Outputs);
+    int64_t sum;
+    uint32_t i = 0;
+    uint32_t j;
+
+    if (1 == N)
+    {
+        for (; i + VEC_32CAP <= M; i += VEC_32CAP)
+        {
+            storeSaturated(load32(bias + i), load32(weight + i), load32(input + i),
+                output + i, config->SaturationCount);
+        }
+        for (; i < M; i++)
+        {
+            sum = (int64_t)bias[i] + weight[i] * input[i];
+            saturate_store_out(&sum, output + i, config->SaturationCount);
+        }
+        return;
+    }
+
+    for (; i < M; i++)
+    {
+        auto const b = set32(bias[i]);
+        auto const w = set32(weight[i]);
+        for (j = 0; j + VEC_32CAP <= N; j += VEC_32CAP)
+        {
+            storeSaturated(b, w, load32(input + i * N + j), output + i * N + j, config->SaturationCount);
+        }
+        for (; j < N; j++)
+        {
+            sum = (int64_t)bias[i] + weight[i] * input[i * N + j];
+            saturate_store_out(&sum, output + i * N + j, config->SaturationCount);
+        }
+    }
+}
+
+template<typename WeightType>
+void diagonal(ExecutionKernelConfig<AffineConfig> const * const config, WeightType const * const weight)
+{
+    auto const * const bias = config->RequestConfig->Transform.biasesSimple;
+    switch (config->RequestConfig->Transform.bytesPerBias)
+    {
+    case 1:
+        diagonal(config, weight, reinterpret_cast<int8_t const *>(bias));
+        break;
+    case 2:
+        diagonal(config, weight, reinterpret_cast<int16_t const *>(bias));
+        break;
+    case 4:
+        diagonal(config, weight, reinterpret_cast<int32_t const *>(bias));
+        break;
+    default:
+        break;
+    }
+}
+
+}
+
+void AffineKernelImpl1B1B(ExecutionKernelConfig<AffineConfig> const * const config)
+{
+    affine(config, config->RequestConfig->Transform.weights1B, config->RequestConfig->Transform.biasesSimple,
+        1, nullptr, config->RequestConfig->Transform.outputElementCount);
+}
+
+void AffineKernelImpl2B1B(ExecutionKernelConfig<AffineConfig> const * const config)
+{
+    affine(config, config->RequestConfig->Transform.weights2B, config->RequestConfig->Transform.biasesSimple,
+        1, nullptr, config->RequestConfig->Transform.outputElementCount);
+}
+
+void AffineActiveListKernelImpl1B1B(ExecutionKernelConfig<AffineConfig> const * const config, AffineConfigAl al)
+{
+    affine(config, config->RequestConfig->Transform.weights1B, config->RequestConfig->Transform.biasesSimple,
+        1, al.indices, al.count);
+}
+
+void AffineActiveListKernelImpl2B1B(ExecutionKernelConfig<AffineConfig> const * const config, AffineConfigAl al)
+{
+    affine(config, config->RequestConfig->Transform.weights2B, config->RequestConfig->Transform.biasesSimple,
+        1, al.indices, al.count);
+}
+
+void AffineMultiBiasKernelImpl1B1B(ExecutionKernelConfig<AffineConfig> const * const config)
+{
+    affine(config, config->RequestConfig->Transform.weights1B, config->RequestConfig->Transform.multiBias,
+        config->RequestConfig->Transform.multiBiasVectorCount, nullptr,
+        config->RequestConfig->Transform.outputElementCount);
+}
+
+void AffineMultiBiasKernelImpl2B1B(ExecutionKernelConfig<AffineConfig> const * const config)
+{
+    affine(config, config->RequestConfig->Transform.weights2B, config->RequestConfig->Transform.multiBias,
+        config->RequestConfig->Transform.multiBiasVectorCount, nullptr,
+        config->RequestConfig->Transform.outputElementCount);
+}
+
+void DiagonalKernelImpl1B1B(ExecutionKernelConfig<AffineConfig> const * const config)
+{
+    diagonal(config, config->RequestConfig->Transform.weights1B);
+}
+
+void DiagonalKernelImpl2B1B(ExecutionKernelConfig<AffineConfig> const * const config)
+{
+    diagonal(config, config->RequestConfig->Transform.weights2B);
+}
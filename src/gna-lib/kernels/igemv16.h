@@ -9,13 +9,15 @@
 #include "KernelMacros.h"
 
 #define AffineKernelImpl2B KERNEL(AffineKernelImpl2B)
+#define AffinePackedKernelImpl2B KERNEL(AffinePackedKernelImpl2B)
+#define AffineBlockedKernelImpl2B KERNEL(AffineBlockedKernelImpl2B)
 #define AffineActiveListKernelImpl2B KERNEL(AffineActiveListKernelImpl2B)
 #define AffineMultiBiasKernelImpl2B KERNEL(AffineMultiBiasKernelImpl2B)
 #define RecurrentKernelImpl2B KERNEL(RecurrentKernelImpl2B)
 #define DiagonalKernelImpl2B KERNEL(DiagonalKernelImpl2B)
 #define TransposeKernelImpl KERNEL(TransposeKernelImpl)
 
-#define AffineActiveListKernelImpl2B1B KERNEL(AffineActiveListKernelImpl2B1B1B)
+#define AffineActiveListKernelImpl2B1B KERNEL(AffineActiveListKernelImpl2B1B)
 #define RecurrentKernelImpl2B1B KERNEL(RecurrentKernelImpl2B1B)
 #define DiagonalKernelImpl2B1B KERNEL(DiagonalKernelImpl2B1B)
 #define AffineKernelImpl2B1B KERNEL(AffineKernelImpl2B1B)
@@ -37,6 +39,16 @@ extern "C" {
 // (input vectors in N columns, vector elements in K rows)
 void AffineKernelImpl2B(ExecutionKernelConfig<AffineConfig> const * const config);
 
+// Calculates affine transform on interleaved input vectors
+// with weights and 32-bit biases repacked by library into AffinePackedLayout
+void AffinePackedKernelImpl2B(ExecutionKernelConfig<AffineConfig> const * const config);
+
+#if OPT_LEVEL == 6
+// Calculates affine transform as AffineKernelImpl2B,
+// in blocks of input elements and outputs when inputs do not fit L2 cache
+void AffineBlockedKernelImpl2B(ExecutionKernelConfig<AffineConfig> const * const config);
+#endif
+
 // Calculates affine transform on interleaved input vectors
 // (input vectors in N columns, vector elements in K rows)
 // uses active outputs list
@@ -54,19 +66,20 @@ void RecurrentKernelImpl2B(ExecutionKernelConfig<RecurrentConfig> const * const
 void DiagonalKernelImpl2B(ExecutionKernelConfig<AffineConfig> const * const config);
 
 void TransposeKernelImpl(TransposeConfig const * const transposeConfig);
-
-#if OPT_LEVEL < 2
 void TransposeKernelImpl1B(TransposeConfig const * const transposeConfig);
 void TransposeKernelImpl2B(TransposeConfig const * const transposeConfig);
+
 void AffineKernelImpl2B1B(ExecutionKernelConfig<AffineConfig> const * const config);
-void AffineKernelImpl2B2B(ExecutionKernelConfig<AffineConfig> const * const config);
 void AffineActiveListKernelImpl2B1B(ExecutionKernelConfig<AffineConfig> const * const config, AffineConfigAl al);
-void AffineActiveListKernelImpl2B2B(ExecutionKernelConfig<AffineConfig> const * const config, AffineConfigAl al);
 void AffineMultiBiasKernelImpl2B1B(ExecutionKernelConfig<AffineConfig> const * const config);
-void AffineMultiBiasKernelImpl2B2B(ExecutionKernelConfig<AffineConfig> const * const config);
+void DiagonalKernelImpl2B1B(ExecutionKernelConfig<AffineConfig> const * const config);
 void RecurrentKernelImpl2B1B(ExecutionKernelConfig<RecurrentConfig> const * const config);
 void RecurrentKernelImpl2B2B(ExecutionKernelConfig<RecurrentConfig> const * const config);
-void DiagonalKernelImpl2B1B(ExecutionKernelConfig<AffineConfig> const * const config);
+
+#if OPT_LEVEL < 2
+void AffineKernelImpl2B2B(ExecutionKernelConfig<AffineConfig> const * const config);
+void AffineActiveListKernelImpl2B2B(ExecutionKernelConfig<AffineConfig> const * const config, AffineConfigAl al);
+void AffineMultiBiasKernelImpl2B2B(ExecutionKernelConfig<AffineConfig> const * const config);
 void DiagonalKernelImpl2B2B(ExecutionKernelConfig<AffineConfig> const * const config);
 #endif
 #ifdef __cplusplus
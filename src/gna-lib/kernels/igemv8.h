@@ -9,6 +9,7 @@
 #include "KernelMacros.h"
 
 #define AffineKernelImpl1B KERNEL(AffineKernelImpl1B)
+#define AffineBlockedKernelImpl1B KERNEL(AffineBlockedKernelImpl1B)
 #define AffineActiveListKernelImpl1B KERNEL(AffineActiveListKernelImpl1B)
 #define AffineMultiBiasKernelImpl1B KERNEL(AffineMultiBiasKernelImpl1B)
 #define RecurrentKernelImpl1B KERNEL(RecurrentKernelImpl1B)
@@ -36,6 +37,12 @@ extern "C" {
 // (input vectors in N columns, vector elements in K rows)
 void AffineKernelImpl1B(ExecutionKernelConfig<AffineConfig> const * const config);
 
+#if OPT_LEVEL == 6
+// Calculates affine transform as AffineKernelImpl1B,
+// in blocks of input elements and outputs when inputs do not fit L2 cache
+void AffineBlockedKernelImpl1B(ExecutionKernelConfig<AffineConfig> const * const config);
+#endif
+
 // Calculates affine transform on interleaved input vectors
 // (input vectors in N columns, vector elements in K rows)
 // uses active outputs list
@@ -53,16 +60,17 @@ void RecurrentKernelImpl1B(ExecutionKernelConfig<RecurrentConfig> const * const
 
 void DiagonalKernelImpl1B(ExecutionKernelConfig<AffineConfig> const * const config);
 
-#if OPT_LEVEL <2
 void AffineKernelImpl1B1B(ExecutionKernelConfig<AffineConfig> const * const config);
-void AffineKernelImpl1B2B(ExecutionKernelConfig<AffineConfig> const * const config);
 void AffineActiveListKernelImpl1B1B(ExecutionKernelConfig<AffineConfig> const * const config, AffineConfigAl al);
-void AffineActiveListKernelImpl1B2B(ExecutionKernelConfig<AffineConfig> const * const config, AffineConfigAl al);
 void AffineMultiBiasKernelImpl1B1B(ExecutionKernelConfig<AffineConfig> const * const config);
-void AffineMultiBiasKernelImpl1B2B(ExecutionKernelConfig<AffineConfig> const * const config);
+void DiagonalKernelImpl1B1B(ExecutionKernelConfig<AffineConfig> const * const config);
 void RecurrentKernelImpl1B1B(ExecutionKernelConfig<RecurrentConfig> const * const config);
 void RecurrentKernelImpl1B2B(ExecutionKernelConfig<RecurrentConfig> const * const config);
-void DiagonalKernelImpl1B1B(ExecutionKernelConfig<AffineConfig> const * const config);
+
+#if OPT_LEVEL <2
+void AffineKernelImpl1B2B(ExecutionKernelConfig<AffineConfig> const * const config);
+void AffineActiveListKernelImpl1B2B(ExecutionKernelConfig<AffineConfig> const * const config, AffineConfigAl al);
+void AffineMultiBiasKernelImpl1B2B(ExecutionKernelConfig<AffineConfig> const * const config);
 void DiagonalKernelImpl1B2B(ExecutionKernelConfig<AffineConfig> const * const config);
 #endif
 #ifdef __cplusplus
@@ -54,6 +54,7 @@ void DiagonalKernelImpl2B2B(ExecutionKernelConfig<AffineConfig> const * const co
     }
 }
 
+#if OPT_LEVEL < 2
 void DiagonalKernelImpl2B1B(ExecutionKernelConfig<AffineConfig> const * const config)
 {
     uint32_t i;
@@ -68,10 +69,11 @@ void DiagonalKernelImpl2B1B(ExecutionKernelConfig<AffineConfig> const * const co
     {
         for (j = 0; j < config->RequestConfig->Transform.inputVectorCount; j++)
         {
-            sum = getBias(bias, config->RequestConfig->Transform.bytesPerBias, i)
+            sum = (int64_t)getBias(bias, config->RequestConfig->Transform.bytesPerBias, i)
                 + (weight[i] * input[i * config->RequestConfig->Transform.inputVectorCount + j]);
 
             saturate_store_out(&sum, &output[i * config->RequestConfig->Transform.inputVectorCount + j], config->SaturationCount);
         }
     }
 }
+#endif
@@ -55,6 +55,7 @@ void DiagonalKernelImpl1B2B(ExecutionKernelConfig<AffineConfig> const * const co
     }
 }
 
+#if OPT_LEVEL < 2
 void DiagonalKernelImpl1B1B(ExecutionKernelConfig<AffineConfig> const * const config)
 {
     uint32_t i;
@@ -69,10 +70,11 @@ void DiagonalKernelImpl1B1B(ExecutionKernelConfig<AffineConfig> const * const co
     {
         for (j = 0; j < config->RequestConfig->Transform.inputVectorCount; j++)
         {
-            sum = getBias(bias, config->RequestConfig->Transform.bytesPerBias, i)
+            sum = (int64_t)getBias(bias, config->RequestConfig->Transform.bytesPerBias, i)
                 + (weight[i] * input[i * config->RequestConfig->Transform.inputVectorCount + j]);
 
             saturate_store_out(&sum, &output[i * config->RequestConfig->Transform.inputVectorCount + j], config->SaturationCount);
         }
     }
 }
+#endif
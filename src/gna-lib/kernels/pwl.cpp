@@ -20,6 +20,7 @@
 #endif
 
 #include <cstdint>
+#include <cstring>
 #include <stdexcept>
 
 using namespace GNA;
@@ -556,32 +557,217 @@ void pwlKernelImplAllLookup(ExecutionKernelConfig<ActivationConfig> const * cons
     } while (input < inputEnd);
 }
 
-void PwlCached::KERNEL(InitializeActivationFunctions)() const
+#if OPT_LEVEL > 5
+// Maximum number of segments compared with broadcast xBases before gathered search
+const uint32_t PWL_VECTOR_PIVOT_COUNT = 32;
+
+// Vector search parameters, loaded once per activation
+struct PwlVectorSearch
+{
+    int32_t const * xBase;
+    long long const * segments;
+    uint32_t segmentCount;
+    uint32_t stride;                    // distance between pivots compared with broadcast xBases
+    __m256i pivotCount;
+    __m256i segmentCountVector;
+};
+
+// Applies segments to inputs held in low dwords of 64-bit lanes, whole segments are held in lanes
+// with xBase and shift in low and yBase and slope in high dword, returns result in low dwords
+static __forceinline __m256i pwlApplyVector(__m256i const input, __m256i const segment,
+    __m256i const outputMin, __m256i const outputMax, uint32_t const validMask,
+    uint32_t * const saturationCount)
+{
+    // inputs below first segment give its yBase
+    auto const xBase = _mm256_and_si256(segment, _mm256_set1_epi32(XBASEMASK));
+    auto const difference = _mm256_andnot_si256(_mm256_cmpgt_epi32(xBase, input),
+        _mm256_sub_epi32(input, xBase));
+    auto const shift = _mm256_slli_epi64(_mm256_add_epi64(
+        _mm256_and_si256(segment, _mm256_set1_epi64x(~XBASEMASK)), _mm256_set1_epi64x(1)), BIT_SHIFT_SIZE);
+    auto const slopeYBase = _mm256_shuffle_epi32(segment, _MM_SHUFFLE(3, 3, 1, 1));
+    auto const slope = _mm256_srai_epi32(slopeYBase, 16);
+    auto const yBase = _mm256_srai_epi32(_mm256_slli_epi32(slopeYBase, 16), 16);
+
+    // difference fits 32 unsigned bits, signed product is built from unsigned one
+    auto const slopeSign = _mm256_srai_epi32(slope, 31);
+    auto product = _mm256_mul_epu32(difference, _mm256_abs_epi32(slope));
+    product = _mm256_sub_epi64(_mm256_xor_si256(product, slopeSign), slopeSign);
+#if 1 == GNA_SAT
+    // arithmetic shift emulated with logical one
+    auto const productSign = _mm256_cmpgt_epi64(_mm256_setzero_si256(), product);
+    auto sum = _mm256_xor_si256(_mm256_srlv_epi64(_mm256_xor_si256(product, productSign), shift), productSign);
+    sum = _mm256_add_epi64(sum, _mm256_blend_epi32(yBase, _mm256_srai_epi32(yBase, 31), 0xaa));
+    auto const isAbove = _mm256_cmpgt_epi64(sum, outputMax);
+    auto const isUnder = _mm256_cmpgt_epi64(outputMin, sum);
+    sum = _mm256_blendv_epi8(sum, outputMax, isAbove);
+    sum = _mm256_blendv_epi8(sum, outputMin, isUnder);
+    auto const saturated = static_cast<uint32_t>(
+        _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_or_si256(isAbove, isUnder))));
+    *saturationCount += static_cast<uint32_t>(_mm_popcnt_u32(saturated & validMask));
+    return sum;
+#else
+    UNREFERENCED_PARAMETER(outputMin);
+    UNREFERENCED_PARAMETER(outputMax);
+    UNREFERENCED_PARAMETER(validMask);
+    UNREFERENCED_PARAMETER(saturationCount);
+    // low dword of result does not depend on shifted in bits
+    return _mm256_add_epi32(_mm256_srlv_epi64(product, shift), yBase);
+#endif
+}
+
+// Activates 8 inputs at once, segments are found by counting pivots not above input
+// and refined with gathered binary search, first validCount lanes are counted when saturated
+static __forceinline __m256i pwlActivateVector(PwlVectorSearch const & search, __m256i const input,
+    __m256i const outputMin, __m256i const outputMax, uint32_t const validCount,
+    uint32_t * const saturationCount)
+{
+    // pivots are ascending, so every pivot above input decrements last pivot index
+    auto pivotsAbove = _mm256_setzero_si256();
+    auto pivotsAboveOdd = _mm256_setzero_si256();
+    auto pivot = search.stride;
+    for (; pivot + search.stride < search.segmentCount; pivot += 2 * search.stride)
+    {
+        pivotsAbove = _mm256_add_epi32(pivotsAbove,
+            _mm256_cmpgt_epi32(_mm256_set1_epi32(search.xBase[pivot]), input));
+        pivotsAboveOdd = _mm256_add_epi32(pivotsAboveOdd,
+            _mm256_cmpgt_epi32(_mm256_set1_epi32(search.xBase[pivot + search.stride]), input));
+    }
+    if (pivot < search.segmentCount)
+    {
+        pivotsAbove = _mm256_add_epi32(pivotsAbove,
+            _mm256_cmpgt_epi32(_mm256_set1_epi32(search.xBase[pivot]), input));
+    }
+    auto segment = _mm256_add_epi32(search.pivotCount, _mm256_add_epi32(pivotsAbove, pivotsAboveOdd));
+
+    if (search.stride > 1)
+    {
+        segment = _mm256_mullo_epi32(segment, _mm256_set1_epi32(static_cast<int32_t>(search.stride)));
+        for (auto step = search.stride >> 1; step > 0; step >>= 1)
+        {
+            auto const candidate = _mm256_add_epi32(segment, _mm256_set1_epi32(static_cast<int32_t>(step)));
+            auto const candidateXBase = _mm256_i32gather_epi32(search.xBase, candidate, sizeof(int32_t));
+            auto const isBelow = _mm256_andnot_si256(_mm256_cmpgt_epi32(candidateXBase, input),
+                _mm256_cmpgt_epi32(search.segmentCountVector, candidate));
+            segment = _mm256_blendv_epi8(segment, candidate, isBelow);
+        }
+    }
+
+    // even lanes are applied in low and odd in high dwords of 64-bit lanes
+    segment = _mm256_permutevar8x32_epi32(segment, _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7));
+    auto const even = pwlApplyVector(input,
+        _mm256_i32gather_epi64(search.segments, _mm256_castsi256_si128(segment), sizeof(nn_pwl_seg)),
+        outputMin, outputMax, (1u << ((validCount + 1) / 2)) - 1, saturationCount);
+    auto const odd = pwlApplyVector(_mm256_srli_epi64(input, 32),
+        _mm256_i32gather_epi64(search.segments, _mm256_extracti128_si256(segment, 1), sizeof(nn_pwl_seg)),
+        outputMin, outputMax, (1u << (validCount / 2)) - 1, saturationCount);
+    return _mm256_blend_epi32(even, _mm256_slli_epi64(odd, 32), 0xaa);
+}
+
+// Packs low bytesPerOutput bytes of 32-bit elements into low part of vector
+static __forceinline __m256i pwlPackVector(__m256i const values, uint32_t const bytesPerOutput)
+{
+    if (4 == bytesPerOutput)
+    {
+        return values;
+    }
+    auto const lowBytes = (2 == bytesPerOutput)
+        ? _mm256_setr_epi8(0, 1, 4, 5, 8, 9, 12, 13, -1, -1, -1, -1, -1, -1, -1, -1,
+            0, 1, 4, 5, 8, 9, 12, 13, -1, -1, -1, -1, -1, -1, -1, -1)
+        : _mm256_setr_epi8(0, 4, 8, 12, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+            0, 4, 8, 12, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1);
+    auto const lanes = (2 == bytesPerOutput)
+        ? _mm256_setr_epi32(0, 1, 4, 5, 2, 3, 6, 7)
+        : _mm256_setr_epi32(0, 4, 1, 2, 3, 5, 6, 7);
+    return _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(values, lowBytes), lanes);
+}
+
+#define pwlKernelImplAllVector KERNEL(pwlKernelImplAllVector)
+void pwlKernelImplAllVector(ExecutionKernelConfig<ActivationConfig> const * const config)
 {
+    auto const pwl = &config->RequestConfig->Transform.Kernel->pwl;
+    auto const * input = reinterpret_cast<int32_t const *>(config->RequestConfig->Inputs);
+    auto * output = config->RequestConfig->Outputs;
+    auto const bytesPerOutput = pwl->bytesPerOutput;
+    auto const elementCount = config->RequestConfig->Transform.ElementCount;
+    auto const outputBits = 8 * bytesPerOutput - 1;
+    auto const outputMax = _mm256_set1_epi64x((INT64_C(1) << outputBits) - 1);
+    auto const outputMin = _mm256_set1_epi64x(-(INT64_C(1) << outputBits));
+    PwlVectorSearch search;
+    search.xBase = pwl->Vector.xBase;
+    search.segments = reinterpret_cast<long long const *>(pwl->Vector.segments);
+    search.segmentCount = pwl->segmentCount;
+    search.stride = pwl->Vector.searchCount > PWL_VECTOR_PIVOT_COUNT
+        ? pwl->Vector.searchCount / PWL_VECTOR_PIVOT_COUNT : 1;
+    search.pivotCount = _mm256_set1_epi32(static_cast<int32_t>((search.segmentCount - 1) / search.stride));
+    search.segmentCountVector = _mm256_set1_epi32(static_cast<int32_t>(search.segmentCount));
+
+    // all inputs are loaded before outputs are stored, so in-place activation is safe
+    uint32_t i = 0;
+    for (; i + 8 <= elementCount; i += 8)
+    {
+        auto const values = pwlPackVector(pwlActivateVector(search,
+            _mm256_loadu_si256(reinterpret_cast<__m256i const *>(input + i)),
+            outputMin, outputMax, 8, config->SaturationCount), bytesPerOutput);
+        auto * const out = output + i * bytesPerOutput;
+        if (4 == bytesPerOutput)
+        {
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(out), values);
+        }
+        else if (2 == bytesPerOutput)
+        {
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(out), _mm256_castsi256_si128(values));
+        }
+        else
+        {
+            _mm_storel_epi64(reinterpret_cast<__m128i *>(out), _mm256_castsi256_si128(values));
+        }
+    }
+    if (i < elementCount)
+    {
+        auto const count = elementCount - i;
+        auto const mask = _mm256_cmpgt_epi32(_mm256_set1_epi32(static_cast<int32_t>(count)),
+            _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+        int8_t packed[sizeof(__m256i)];
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(packed), pwlPackVector(pwlActivateVector(search,
+            _mm256_maskload_epi32(input + i, mask),
+            outputMin, outputMax, count, config->SaturationCount), bytesPerOutput));
+        memcpy(output + i * bytesPerOutput, packed, count * bytesPerOutput);
+    }
+}
+#endif
+
+PwlActivation PwlCached::KERNEL(GetActivationFunctions)() const
+{
+    PwlActivation activation;
     if (useLookup)
     {
-        ActivateAll = pwlKernelImplAllLookup;
-        ActivateSingle = pwlKernelImplSingleLookup;
+        activation = { pwlKernelImplSingleLookup, pwlKernelImplAllLookup };
     }
     else
     {
         if (pwl.segmentCount > PWL_SIZE_OPT_ALGORITHM_TRESHOLD)
         {
-            ActivateAll = pwlKernelImplAllBinaryOpt;
-            ActivateSingle = pwlKernelImplSingleBinaryOpt;
+            activation = { pwlKernelImplSingleBinaryOpt, pwlKernelImplAllBinaryOpt };
         }
         else if (pwl.segmentCount > PWL_SIZE_ALGORITHM_TRESHOLD)
         {
-            ActivateAll = pwlKernelImplAllBinary;
-            ActivateSingle = pwlKernelImplSingleBinary;
+            activation = { pwlKernelImplSingleBinary, pwlKernelImplAllBinary };
         }
         else
         {
-            ActivateAll = pwlKernelImplAllLinear;
-            ActivateSingle = pwlKernelImplSingleLinear;
+            activation = { pwlKernelImplSingleLinear, pwlKernelImplAllLinear };
         }
     }
-
+#if OPT_LEVEL > 5
+    // lookup outperforms gathered search steps of longer PWLs
+    auto const useVector = !useLookup || pwl.segmentCount <= PWL_VECTOR_PIVOT_COUNT;
+    if (useVector && nullptr != pwl.Vector.xBase &&
+        (1 == pwl.bytesPerOutput || 2 == pwl.bytesPerOutput || 4 == pwl.bytesPerOutput))
+    {
+        activation.ActivateAll = pwlKernelImplAllVector;
+    }
+#endif
+    return activation;
 }
 
 #if OPT_LEVEL == 0
@@ -590,6 +776,7 @@ PwlCached::PwlCached(PwlCached && pwlCached)
 {
     memcpy_s(this, sizeof(*this), &pwlCached, sizeof(pwlCached));
     pwlCached.pwl.data = nullptr;
+    pwlCached.pwl.Vector = {};
 }
 
 PwlCached::PwlCached(const gna_data_mode mode, nn_pwl_seg const * const segmentsIn, uint32_t segmentCountIn)
@@ -602,9 +789,8 @@ PwlCached::PwlCached(const gna_data_mode mode, nn_pwl_seg const * const segments
     int64_t widthTmp = UINT32_MAX;     // pwl.lookup segment widthTmp - minimum distance between pwl.segments' xbases
     uint64_t countTmp = 0;              // pwl.lookup segment countTmp (active)
     pwl_s_t usegTmp;
-    ActivateAll = NULL;
-    ActivateSingle = NULL;
     pwl.segmentCount = segmentCountIn;
+    pwl.Vector = {};
 
     switch(mode)
     {
@@ -784,10 +970,16 @@ PwlCached::PwlCached(const gna_data_mode mode, nn_pwl_seg const * const segments
             pwl.data = nullptr;
         }
     }
+    allocateVectorCaches(segmentsIn);
 }
 
 PwlCached::~PwlCached()
 {
+    if (nullptr != pwl.Vector.xBase)
+    {
+        _gna_free(pwl.Vector.xBase);
+        pwl.Vector = {};
+    }
     if (nullptr != pwl.data)
     {
         _gna_free(pwl.data);
@@ -807,6 +999,47 @@ void PwlCached::allocateBinaryCaches()
     pwl.Params.Binary.ySeg = (pwl_y_t*)((pwl_x_t*)pwl.data + pwl.segmentCount);
 }
 
+void PwlCached::allocateVectorCaches(nn_pwl_seg const * const segmentsIn)
+{
+    if (0 == pwl.segmentCount)
+    {
+        return;
+    }
+    for (uint32_t i = 1; i < pwl.segmentCount; i++)
+    {
+        if ((segmentsIn[i].xBase & XBASEMASK) <= (segmentsIn[i - 1].xBase & XBASEMASK))
+        {
+            return;
+        }
+    }
+
+    uint32_t searchCount = 1;
+    while (searchCount < pwl.segmentCount)
+    {
+        searchCount <<= 1;
+    }
+    auto const xBaseSize = searchCount * sizeof(int32_t);
+    auto const totalSize = xBaseSize + pwl.segmentCount * sizeof(nn_pwl_seg);
+    auto * const data = static_cast<uint8_t*>(_gna_malloc(totalSize));
+    if (nullptr == data)
+    {
+        throw std::runtime_error("PwlCached::allocateVectorCaches() failed.");
+    }
+    pwl.Vector.xBase = reinterpret_cast<int32_t*>(data);
+    pwl.Vector.segments = reinterpret_cast<nn_pwl_seg*>(data + xBaseSize);
+    pwl.Vector.searchCount = searchCount;
+    memcpy(pwl.Vector.segments, segmentsIn, pwl.segmentCount * sizeof(nn_pwl_seg));
+    for (uint32_t i = 0; i < pwl.segmentCount; i++)
+    {
+        pwl.Vector.xBase[i] = segmentsIn[i].xBase & XBASEMASK;
+    }
+    // padding is never selected, search checks segment count
+    for (uint32_t i = pwl.segmentCount; i < searchCount; i++)
+    {
+        pwl.Vector.xBase[i] = INT32_MAX;
+    }
+}
+
 void PwlCached::allocateLookupCaches()
 {
     pwl.data = _gna_malloc(PWL_LOOKUP_SIZE);
@@ -92,6 +92,14 @@ struct PwlCachedConfig
             uint8_t _reserved[6];       // padding
         } Binary;
     } Params;
+
+    // Segments unpacked for vectorized search, set only for ascending xBases
+    struct
+    {
+        int32_t* xBase;                 // extracted xBase values padded to searchCount
+        nn_pwl_seg* segments;           // copy of source segments, gathered by search result
+        uint32_t searchCount;           // power of 2 not lower than segment count
+    } Vector;
 };
 
 // Function pointer for apply PWL for single input-output
@@ -101,19 +109,27 @@ typedef void(*PwlApplySingle)(PwlCachedConfig const * const pwl, int32_t I, int1
 // Function pointer for apply PWL for all inputs-outputs
 typedef void(*PwlApplyAll)(ExecutionKernelConfig<ActivationConfig> const * const config);
 
+// PWL algorithms selected for given layer and kernel acceleration
+struct PwlActivation
+{
+    PwlApplySingle  ActivateSingle;              // algorithm used for PWL for single in-out
+    PwlApplyAll     ActivateAll;                 // algorithm used for PWL for all in-outs
+};
+
 // PWL cache and config (constant for given layer)
 struct PwlCached
 {
 public:
     bool useLookup = false;
-    void InitializeActivationFunctions_generic() const;
-    void InitializeActivationFunctions_generic_sat() const;
-    void InitializeActivationFunctions_sse4() const;
-    void InitializeActivationFunctions_sse4_sat() const;
-    void InitializeActivationFunctions_avx1() const;
-    void InitializeActivationFunctions_avx1_sat() const;
-    void InitializeActivationFunctions_avx2() const;
-    void InitializeActivationFunctions_avx2_sat() const;
+    // Selection only reads cache, thus layer is activated by concurrent threads
+    PwlActivation GetActivationFunctions_generic() const;
+    PwlActivation GetActivationFunctions_generic_sat() const;
+    PwlActivation GetActivationFunctions_sse4() const;
+    PwlActivation GetActivationFunctions_sse4_sat() const;
+    PwlActivation GetActivationFunctions_avx1() const;
+    PwlActivation GetActivationFunctions_avx1_sat() const;
+    PwlActivation GetActivationFunctions_avx2() const;
+    PwlActivation GetActivationFunctions_avx2_sat() const;
 
     // Prepares PWL parameters and auxiliary buffers
     PwlCached(const gna_data_mode mode, nn_pwl_seg const * const segmentsIn, uint32_t segmentCountIn);
@@ -134,13 +150,12 @@ public:
     static const int32_t PWL_LOOKUP_SIZE = (PWL_LOOKUP_COUNT)* PWL_LOOKUP_SEG_SIZE;
 
     PwlCachedConfig pwl;
-    mutable PwlApplySingle  ActivateSingle;              // algorithm used for PWL for single in-out
-    mutable PwlApplyAll     ActivateAll;                 // algorithm used for PWL for all in-outs
     uint32_t bytesPerOutput;
 
 private:
     void allocateLookupCaches();
     void allocateBinaryCaches();
+    void allocateVectorCaches(nn_pwl_seg const * const segmentsIn);
 };
 
 }
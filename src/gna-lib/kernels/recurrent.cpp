@@ -0,0 +1,284 @@
+/**
+ @copyright (C) 2021 Intel Corporation
+ SPDX-License-Identifier: LGPL-2.1-or-later
+ */
+
+// Recurrent kernels for SSE4, AVX1 and AVX2 with 1B and 2B feedback.
+// Each output is a dot product of weight row with flat input vector
+// followed by feedback (previous output) vector, computed with madd.
+// Sat kernels accumulate in 64 bits and saturate the sum to 32 bits
+// every buffer element count elements of concatenated input and feedback,
+// matching generic kernels.
+
+#include "igemv.h"
+#include "igemv8.h"
+#include "igemv16.h"
+
+#include "KernelArguments.h"
+#include "KernelMacros.h"
+
+#include "common.h"
+#include "gna-api-types-xnn.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <immintrin.h>
+#include <type_traits>
+
+namespace
+{
+
+#if OPT_LEVEL > 5
+constexpr uint32_t VEC_CAP = 16;
+
+__forceinline mm_vector load16(int8_t const * const data)
+{
+    return _mm256_cvtepi8_epi16(_mm_loadu_si128((__m128i const *)data));
+}
+
+__forceinline mm_vector load16(int16_t const * const data)
+{
+    return _mm256_loadu_si256((__m256i const *)data);
+}
+
+__forceinline mm_vector madd(mm_vector const a, mm_vector const b)
+{
+    return _mm256_madd_epi16(a, b);
+}
+
+__forceinline mm_vector add32(mm_vector const a, mm_vector const b)
+{
+    return _mm256_add_epi32(a, b);
+}
+
+__forceinline int32_t horizontalSum32(mm_vector const acc)
+{
+    __m128i s = _mm_add_epi32(_mm256_castsi256_si128(acc), _mm256_extracti128_si256(acc, 1));
+    s = _mm_hadd_epi32(s, s);
+    s = _mm_hadd_epi32(s, s);
+    return _mm_cvtsi128_si32(s);
+}
+
+// Adds 32-bit elements of x to 64-bit accumulator,
+// when isMaddOverflow is set INT32_MIN elements are treated as 2^31
+__forceinline mm_vector add64(mm_vector const acc, mm_vector const x, bool const isMaddOverflow)
+{
+    auto lo = _mm256_cvtepi32_epi64(_mm256_castsi256_si128(x));
+    auto hi = _mm256_cvtepi32_epi64(_mm256_extracti128_si256(x, 1));
+    if (isMaddOverflow)
+    {
+        auto const overflow = _mm256_cmpeq_epi32(x, _mm256_set1_epi32(INT32_MIN));
+        auto const correction = _mm256_set1_epi64x(INT64_C(1) << 32);
+        lo = _mm256_add_epi64(lo, _mm256_and_si256(
+            _mm256_cvtepi32_epi64(_mm256_castsi256_si128(overflow)), correction));
+        hi = _mm256_add_epi64(hi, _mm256_and_si256(
+            _mm256_cvtepi32_epi64(_mm256_extracti128_si256(overflow, 1)), correction));
+    }
+    return _mm256_add_epi64(acc, _mm256_add_epi64(lo, hi));
+}
+
+__forceinline int64_t horizontalSum64(mm_vector const acc)
+{
+    __m128i s = _mm_add_epi64(_mm256_castsi256_si128(acc), _mm256_extracti128_si256(acc, 1));
+    return _mm_extract_epi64(s, 0) + _mm_extract_epi64(s, 1);
+}
+#else // SSE4 & AVX1
+constexpr uint32_t VEC_CAP = 8;
+
+__forceinline mm_vector load16(int8_t const * const data)
+{
+    return _mm_cvtepi8_epi16(_mm_loadl_epi64((__m128i const *)data));
+}
+
+__forceinline mm_vector load16(int16_t const * const data)
+{
+    return _mm_loadu_si128((__m128i const *)data);
+}
+
+__forceinline mm_vector madd(mm_vector const a, mm_vector const b)
+{
+    return _mm_madd_epi16(a, b);
+}
+
+__forceinline mm_vector add32(mm_vector const a, mm_vector const b)
+{
+    return _mm_add_epi32(a, b);
+}
+
+__forceinline int32_t horizontalSum32(mm_vector const acc)
+{
+    __m128i s = _mm_hadd_epi32(acc, acc);
+    s = _mm_hadd_epi32(s, s);
+    return _mm_cvtsi128_si32(s);
+}
+
+__forceinline mm_vector add64(mm_vector const acc, mm_vector const x, bool const isMaddOverflow)
+{
+    auto lo = _mm_cvtepi32_epi64(x);
+    auto hi = _mm_cvtepi32_epi64(_mm_srli_si128(x, 8));
+    if (isMaddOverflow)
+    {
+        auto const overflow = _mm_cmpeq_epi32(x, _mm_set1_epi32(INT32_MIN));
+        auto const correction = _mm_set1_epi64x(INT64_C(1) << 32);
+        lo = _mm_add_epi64(lo, _mm_and_si128(_mm_cvtepi32_epi64(overflow), correction));
+        hi = _mm_add_epi64(hi, _mm_and_si128(_mm_cvtepi32_epi64(_mm_srli_si128(overflow, 8)), correction));
+    }
+    return _mm_add_epi64(acc, _mm_add_epi64(lo, hi));
+}
+
+__forceinline int64_t horizontalSum64(mm_vector const acc)
+{
+    return _mm_extract_epi64(acc, 0) + _mm_extract_epi64(acc, 1);
+}
+#endif
+
+// Calculates dot product of count contiguous data and weight elements,
+// exact for sat kernels and truncated to 32 bits for fast kernels
+template<typename DataType, typename WeightType>
+__forceinline int64_t dotProduct(DataType const * const data, WeightType const * const weight,
+    uint32_t const count)
+{
+    int64_t sum = 0;
+    uint32_t i = 0;
+
+#if GNA_SAT
+    // madd can overflow only for -32768 * -32768 pairs of 2B data,
+    // for 1B data or weights partial sums are accumulated in 32 bits
+    constexpr bool isMaddOverflow = std::is_same<DataType, int16_t>::value
+        && std::is_same<WeightType, int16_t>::value;
+    constexpr uint32_t iterations32 = isMaddOverflow ? 1 : 64;
+    auto acc64 = vec_setzero();
+
+    while (i + VEC_CAP <= count)
+    {
+        auto acc32 = vec_setzero();
+        auto const end = (std::min)(count - (count - i) % VEC_CAP, i + iterations32 * VEC_CAP);
+        for (; i < end; i += VEC_CAP)
+        {
+            acc32 = add32(acc32, madd(load16(data + i), load16(weight + i)));
+        }
+        acc64 = add64(acc64, acc32, isMaddOverflow);
+    }
+    sum = horizontalSum64(acc64);
+#else
+    auto acc32 = vec_setzero();
+    for (; i + VEC_CAP <= count; i += VEC_CAP)
+    {
+        acc32 = add32(acc32, madd(load16(data + i), load16(weight + i)));
+    }
+    sum = horizontalSum32(acc32);
+#endif
+    for (; i < count; i++)
+    {
+        sum += (int64_t)data[i] * weight[i];
+    }
+    return sum;
+}
+
+// Calculates single output from input and feedback,
+// for sat kernels sum is saturated every partSize elements of weight row
+template<typename InputType, typename FeedbackType, typename WeightType>
+__forceinline int32_t recurrentOutput(InputType const * const input, uint32_t const inputCount,
+    FeedbackType const * const feedback, uint32_t const feedbackCount, WeightType const * const weight,
+    int64_t const bias, int64_t const multiplier, uint32_t const partSize, uint32_t * const saturationCount)
+{
+#if GNA_SAT
+    uint32_t const rowSize = inputCount + feedbackCount;
+    int64_t sum = bias;
+    for (uint32_t k = 0; k < rowSize;)
+    {
+        uint32_t const end = (std::min)(k - k % partSize + partSize, rowSize);
+        int64_t partial = 0;
+        if (k < inputCount)
+        {
+            auto const inputEnd = (std::min)(end, inputCount);
+            partial += dotProduct(input + k, weight + k, inputEnd - k);
+        }
+        if (end > inputCount)
+        {
+            auto const begin = (std::max)(k, inputCount);
+            partial += dotProduct(feedback + begin - inputCount, weight + begin, end - begin);
+        }
+        sum += partial * multiplier;
+        saturate(&sum, saturationCount);
+        k = end;
+    }
+    return (int32_t)sum;
+#else
+    UNREFERENCED_PARAMETER(partSize);
+    UNREFERENCED_PARAMETER(saturationCount);
+    // 32-bit wrap around gives the same result as generic kernels
+    auto const sum = (uint32_t)dotProduct(input, weight, inputCount)
+        + (uint32_t)dotProduct(feedback, weight + inputCount, feedbackCount);
+    return (int32_t)((uint32_t)bias + sum * (uint32_t)multiplier);
+#endif
+}
+
+template<typename InputType, typename FeedbackType, typename WeightType>
+void recurrent(ExecutionKernelConfig<RecurrentConfig> const * const config, uint32_t const partSize)
+{
+    auto const & transform = config->RequestConfig->Transform;
+    auto const * const input = reinterpret_cast<InputType const *>(config->RequestConfig->Inputs);
+    auto const * const feedback = reinterpret_cast<FeedbackType const *>(transform.feedbackBuffer);
+    auto const * weight = reinterpret_cast<WeightType const *>(transform.weights1B);
+    auto * const output = transform.output;
+    uint32_t const inputCount = transform.inputElementCount;
+    uint32_t const outputCount = transform.outputElementCount;
+    uint32_t const rowSize = inputCount + outputCount;
+
+    for (uint32_t i = 0; i < outputCount; i++, weight += rowSize)
+    {
+        int64_t bias;
+        int64_t multiplier = 1;
+        if (std::is_same<WeightType, int8_t>::value && std::is_same<InputType, int16_t>::value)
+        {
+            // 1B weights with 2B input use compound bias
+            bias = transform.biasesCompound[i].bias;
+            multiplier = transform.biasesCompound[i].multiplier;
+        }
+        else
+        {
+            bias = getBias(transform.biasesSimple, transform.bytesPerBias, i);
+        }
+        output[i] = recurrentOutput(input, inputCount, feedback, outputCount, weight,
+            bias, multiplier, partSize, config->SaturationCount);
+    }
+}
+
+template<typename InputType, typename WeightType>
+void recurrent(ExecutionKernelConfig<RecurrentConfig> const * const config)
+{
+    // 1B input kernels use 1B input buffer size
+    uint32_t const partSize = config->BufferElementCount[
+        std::is_same<InputType, int8_t>::value ? 0 : XNN_N_GROUP_MAX];
+    if (config->RequestConfig->Transform.bytesPerOutput == 1)
+    {
+        recurrent<InputType, int8_t, WeightType>(config, partSize);
+    }
+    else
+    {
+        recurrent<InputType, int16_t, WeightType>(config, partSize);
+    }
+}
+
+}
+
+void RecurrentKernelImpl1B1B(ExecutionKernelConfig<RecurrentConfig> const * const config)
+{
+    recurrent<int8_t, int8_t>(config);
+}
+
+void RecurrentKernelImpl1B2B(ExecutionKernelConfig<RecurrentConfig> const * const config)
+{
+    recurrent<int16_t, int8_t>(config);
+}
+
+void RecurrentKernelImpl2B1B(ExecutionKernelConfig<RecurrentConfig> const * const config)
+{
+    recurrent<int8_t, int16_t>(config);
+}
+
+void RecurrentKernelImpl2B2B(ExecutionKernelConfig<RecurrentConfig> const * const config)
+{
+    recurrent<int16_t, int16_t>(config);
+}
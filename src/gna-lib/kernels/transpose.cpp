@@ -0,0 +1,490 @@
+/**
+ @copyright (C) 2021 Intel Corporation
+ SPDX-License-Identifier: LGPL-2.1-or-later
+ */
+
+// Transposition kernels for SSE4, AVX1 and AVX2 with 1B and 2B data of any shape.
+// Blocks of matrix are transposed in registers with rounds of unpacks,
+// each round interleaves register k with register k + count / 2,
+// what rotates element address bits (row | column) in block left by one bit,
+// so after log2(block rows) rounds block is stored column after column.
+// Narrow matrices (interleave and deinterleave) use blocks of padded
+// power of 2 rows or columns, larger matrices use square tiles.
+// AVX2 kernels transpose two blocks side by side, one per 128-bit lane.
+
+#include "Macros.h"
+
+#include "igemv16.h"
+
+#include "KernelArguments.h"
+#include "KernelMacros.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <immintrin.h>
+
+namespace
+{
+
+#if OPT_LEVEL > 5
+constexpr uint32_t LANES = 2;
+
+__forceinline mm_vector loadVector(void const * const data)
+{
+    return _mm256_loadu_si256((__m256i const *)data);
+}
+
+__forceinline mm_vector combineLanes(__m128i const low, __m128i const high)
+{
+    return _mm256_inserti128_si256(_mm256_castsi128_si256(low), high, 1);
+}
+
+__forceinline __m128i getLane(mm_vector const data, uint32_t const lane)
+{
+    return lane == 0 ? _mm256_castsi256_si128(data) : _mm256_extracti128_si256(data, 1);
+}
+
+__forceinline void storeVector(void * const data, mm_vector const vector)
+{
+    _mm256_storeu_si256((__m256i *)data, vector);
+}
+
+__forceinline mm_vector shuffle(mm_vector const data, mm_vector const mask)
+{
+    return _mm256_shuffle_epi8(data, mask);
+}
+
+__forceinline mm_vector broadcastLane(__m128i const data)
+{
+    return _mm256_broadcastsi128_si256(data);
+}
+
+template<typename T>
+__forceinline mm_vector unpackLo(mm_vector const a, mm_vector const b);
+template<>
+__forceinline mm_vector unpackLo<int8_t>(mm_vector const a, mm_vector const b)
+{
+    return _mm256_unpacklo_epi8(a, b);
+}
+template<>
+__forceinline mm_vector unpackLo<int16_t>(mm_vector const a, mm_vector const b)
+{
+    return _mm256_unpacklo_epi16(a, b);
+}
+
+template<typename T>
+__forceinline mm_vector unpackHi(mm_vector const a, mm_vector const b);
+template<>
+__forceinline mm_vector unpackHi<int8_t>(mm_vector const a, mm_vector const b)
+{
+    return _mm256_unpackhi_epi8(a, b);
+}
+template<>
+__forceinline mm_vector unpackHi<int16_t>(mm_vector const a, mm_vector const b)
+{
+    return _mm256_unpackhi_epi16(a, b);
+}
+#else // SSE4 & AVX1
+constexpr uint32_t LANES = 1;
+
+__forceinline mm_vector loadVector(void const * const data)
+{
+    return _mm_loadu_si128((__m128i const *)data);
+}
+
+__forceinline __m128i getLane(mm_vector const data, uint32_t const lane)
+{
+    UNREFERENCED_PARAMETER(lane);
+    return data;
+}
+
+__forceinline void storeVector(void * const data, mm_vector const vector)
+{
+    _mm_storeu_si128((__m128i *)data, vector);
+}
+
+__forceinline mm_vector shuffle(mm_vector const data, mm_vector const mask)
+{
+    return _mm_shuffle_epi8(data, mask);
+}
+
+__forceinline mm_vector broadcastLane(__m128i const data)
+{
+    return data;
+}
+
+template<typename T>
+__forceinline mm_vector unpackLo(mm_vector const a, mm_vector const b);
+template<>
+__forceinline mm_vector unpackLo<int8_t>(mm_vector const a, mm_vector const b)
+{
+    return _mm_unpacklo_epi8(a, b);
+}
+template<>
+__forceinline mm_vector unpackLo<int16_t>(mm_vector const a, mm_vector const b)
+{
+    return _mm_unpacklo_epi16(a, b);
+}
+
+template<typename T>
+__forceinline mm_vector unpackHi(mm_vector const a, mm_vector const b);
+template<>
+__forceinline mm_vector unpackHi<int8_t>(mm_vector const a, mm_vector const b)
+{
+    return _mm_unpackhi_epi8(a, b);
+}
+template<>
+__forceinline mm_vector unpackHi<int16_t>(mm_vector const a, mm_vector const b)
+{
+    return _mm_unpackhi_epi16(a, b);
+}
+#endif
+
+constexpr uint32_t getLog2(uint32_t const value)
+{
+    return value <= 1 ? 0 : 1 + getLog2(value / 2);
+}
+
+template<typename T, uint32_t Count, uint32_t Rounds>
+__forceinline void unpackRounds(mm_vector * const data)
+{
+    for (uint32_t round = 0; round < Rounds; round++)
+    {
+        mm_vector unpacked[Count];
+        for (uint32_t k = 0; k < Count / 2; k++)
+        {
+            unpacked[2 * k] = unpackLo<T>(data[k], data[k + Count / 2]);
+            unpacked[2 * k + 1] = unpackHi<T>(data[k], data[k + Count / 2]);
+        }
+        for (uint32_t k = 0; k < Count; k++)
+        {
+            data[k] = unpacked[k];
+        }
+    }
+}
+
+template<typename T>
+class Transposition
+{
+public:
+    // elements in 128-bit lane
+    static constexpr uint32_t LaneElements = sizeof(__m128i) / sizeof(T);
+    // elements in vector
+    static constexpr uint32_t VectorElements = LaneElements * LANES;
+
+    explicit Transposition(TransposeConfig const * const config) :
+        input{ reinterpret_cast<T const *>(config->input) },
+        output{ reinterpret_cast<T *>(config->output) },
+        rowCount{ config->rowCount },
+        columnCount{ config->columnCount },
+        inputEnd{ input + rowCount * columnCount },
+        outputEnd{ output + rowCount * columnCount }
+    {
+    }
+
+    void Run() const
+    {
+        if (rowCount <= LaneElements)
+        {
+            interleave();
+        }
+        else if (columnCount <= LaneElements)
+        {
+            deinterleave();
+        }
+        else
+        {
+            transposeTiles();
+        }
+    }
+
+private:
+    static uint32_t roundUpToPowerOf2(uint32_t const value)
+    {
+        uint32_t power = 2;
+        while (power < value)
+        {
+            power *= 2;
+        }
+        return power;
+    }
+
+    // Loads 16B of input, elements past input end are zeroed
+    __forceinline __m128i loadLane(T const * const source) const
+    {
+        if (source + LaneElements <= inputEnd)
+        {
+            return _mm_loadu_si128((__m128i const *)source);
+        }
+        T buffer[LaneElements] = {};
+        if (source < inputEnd)
+        {
+            memcpy(buffer, source, static_cast<size_t>(inputEnd - source) * sizeof(T));
+        }
+        return _mm_loadu_si128((__m128i const *)buffer);
+    }
+
+    // Loads lanes of input lane stride elements apart, elements past input end are zeroed
+    __forceinline mm_vector loadLanes(T const * const source, uint32_t const laneStride) const
+    {
+#if OPT_LEVEL > 5
+        return combineLanes(loadLane(source), loadLane(source + laneStride));
+#else
+        UNREFERENCED_PARAMETER(laneStride);
+        return loadLane(source);
+#endif
+    }
+
+    // Loads vector of input row, elements past input end are zeroed
+    __forceinline mm_vector loadRow(T const * const source) const
+    {
+        if (source + VectorElements <= inputEnd)
+        {
+            return loadVector(source);
+        }
+        T buffer[VectorElements] = {};
+        if (source < inputEnd)
+        {
+            memcpy(buffer, source, static_cast<size_t>(inputEnd - source) * sizeof(T));
+        }
+        return loadVector(buffer);
+    }
+
+    // Stores count elements of lane, elements past count may be overwritten
+    // when they are within output and are stored afterwards
+    __forceinline void storeLane(T * const destination, __m128i const data, uint32_t const count) const
+    {
+        if (destination + LaneElements <= outputEnd)
+        {
+            _mm_storeu_si128((__m128i *)destination, data);
+        }
+        else
+        {
+            T buffer[LaneElements];
+            _mm_storeu_si128((__m128i *)buffer, data);
+            memcpy(destination, buffer, count * sizeof(T));
+        }
+    }
+
+    // Stores exactly count elements of lane
+    __forceinline static void storeLanePart(T * const destination, __m128i const data, uint32_t const count)
+    {
+        T buffer[LaneElements];
+        _mm_storeu_si128((__m128i *)buffer, data);
+        memcpy(destination, buffer, count * sizeof(T));
+    }
+
+    // Shuffle mask moving elements from groups of from elements to groups of to elements,
+    // elements of source groups missing in destination groups are dropped,
+    // elements of destination groups missing in source groups are zeroed
+    static mm_vector createRegroupMask(uint32_t const from, uint32_t const to)
+    {
+        alignas(16) int8_t mask[sizeof(__m128i)];
+        for (uint32_t i = 0; i < sizeof(__m128i); i++)
+        {
+            auto const element = i / sizeof(T);
+            auto const group = element / to;
+            auto const index = element % to;
+            auto const source = (group * from + index) * sizeof(T) + i % sizeof(T);
+            mask[i] = (index < from && source < sizeof(__m128i)) ? static_cast<int8_t>(source) : -128;
+        }
+        return broadcastLane(_mm_load_si128((__m128i const *)mask));
+    }
+
+    void interleave() const
+    {
+        switch (roundUpToPowerOf2(rowCount))
+        {
+        case 2:
+            interleave<2>();
+            break;
+        case 4:
+            interleave<4>();
+            break;
+        case 8:
+            interleave<8>();
+            break;
+        default:
+            interleave<LaneElements>();
+            break;
+        }
+    }
+
+    // Transposes matrix of at most lane elements rows,
+    // block of Rows x lane elements (padded with zero rows) is transposed with log2(Rows) rounds,
+    // columns of block in registers are grouped by Rows elements and compacted to row count
+    template<uint32_t Rows>
+    void interleave() const
+    {
+        auto const isPadded = rowCount < Rows;
+        auto const compactMask = isPadded ? createRegroupMask(Rows, rowCount) : vec_setzero();
+        // output elements in lane
+        auto const laneCount = LaneElements / Rows * rowCount;
+
+        for (uint32_t column = 0; column < columnCount; column += VectorElements)
+        {
+            mm_vector data[Rows];
+            for (uint32_t r = 0; r < Rows; r++)
+            {
+                data[r] = r < rowCount ? loadRow(input + r * columnCount + column) : vec_setzero();
+            }
+            unpackRounds<T, Rows, getLog2(Rows)>(data);
+            if (isPadded)
+            {
+                for (uint32_t r = 0; r < Rows; r++)
+                {
+                    data[r] = shuffle(data[r], compactMask);
+                }
+            }
+
+            // output is contiguous, each lane overwrites padding stored by previous one
+            auto * const destination = output + column * rowCount;
+            auto const count = (std::min)(VectorElements, columnCount - column) * rowCount;
+            for (uint32_t lane = 0; lane < LANES; lane++)
+            {
+                for (uint32_t r = 0; r < Rows; r++)
+                {
+                    auto const offset = (lane * Rows + r) * laneCount;
+                    if (offset >= count)
+                    {
+                        break;
+                    }
+                    storeLane(destination + offset, getLane(data[r], lane), (std::min)(laneCount, count - offset));
+                }
+            }
+        }
+    }
+
+    void deinterleave() const
+    {
+        switch (roundUpToPowerOf2(columnCount))
+        {
+        case 2:
+            deinterleave<2>();
+            break;
+        case 4:
+            deinterleave<4>();
+            break;
+        case 8:
+            deinterleave<8>();
+            break;
+        default:
+            deinterleave<LaneElements>();
+            break;
+        }
+    }
+
+    // Transposes matrix of at most lane elements columns,
+    // block of lane elements rows x Columns (padded with zero columns)
+    // is loaded contiguously to Columns registers and transposed with log2(lane elements) rounds
+    template<uint32_t Columns>
+    void deinterleave() const
+    {
+        auto const isPadded = columnCount < Columns;
+        auto const expandMask = isPadded ? createRegroupMask(columnCount, Columns) : vec_setzero();
+        // input rows in lane
+        auto const laneRows = LaneElements / Columns;
+
+        for (uint32_t row = 0; row < rowCount; row += VectorElements)
+        {
+            mm_vector data[Columns];
+            for (uint32_t c = 0; c < Columns; c++)
+            {
+                auto const * const source = input + (row + c * laneRows) * columnCount;
+                data[c] = loadLanes(source, LaneElements * columnCount);
+                if (isPadded)
+                {
+                    data[c] = shuffle(data[c], expandMask);
+                }
+            }
+            unpackRounds<T, Columns, getLog2(LaneElements)>(data);
+
+            auto const rows = rowCount - row;
+            for (uint32_t c = 0; c < columnCount; c++)
+            {
+                auto * const destination = output + c * rowCount + row;
+                if (rows >= VectorElements)
+                {
+                    storeVector(destination, data[c]);
+                }
+                else
+                {
+                    // next output row follows, only valid elements are stored
+                    for (uint32_t lane = 0; lane * LaneElements < rows; lane++)
+                    {
+                        storeLanePart(destination + lane * LaneElements, getLane(data[c], lane),
+                            (std::min)(LaneElements, rows - lane * LaneElements));
+                    }
+                }
+            }
+        }
+    }
+
+    // Transposes matrix in tiles of lane elements rows x vector elements columns
+    void transposeTiles() const
+    {
+        // column tiles outer to keep output rows of tile in cache
+        for (uint32_t column = 0; column < columnCount; column += VectorElements)
+        {
+            auto const columns = (std::min)(VectorElements, columnCount - column);
+            for (uint32_t row = 0; row < rowCount; row += LaneElements)
+            {
+                mm_vector data[LaneElements];
+                auto const rows = (std::min)(LaneElements, rowCount - row);
+                for (uint32_t r = 0; r < LaneElements; r++)
+                {
+                    // elements past row end are loaded from next row and never stored
+                    data[r] = r < rows ? loadRow(input + (row + r) * columnCount + column) : vec_setzero();
+                }
+                unpackRounds<T, LaneElements, getLog2(LaneElements)>(data);
+
+                for (uint32_t c = 0; c < columns; c++)
+                {
+                    auto * const destination = output + (column + c) * rowCount + row;
+                    auto const lane = getLane(data[c % LaneElements], c / LaneElements);
+                    if (rows == LaneElements)
+                    {
+                        _mm_storeu_si128((__m128i *)destination, lane);
+                    }
+                    else
+                    {
+                        // next output row follows, only valid elements are stored
+                        storeLanePart(destination, lane, rows);
+                    }
+                }
+            }
+        }
+    }
+
+    T const * const input;
+    T * const output;
+    uint32_t const rowCount;
+    uint32_t const columnCount;
+    T const * const inputEnd;
+    T const * const outputEnd;
+};
+
+}
+
+void TransposeKernelImpl1B(TransposeConfig const * const transposeConfig)
+{
+    if (transposeConfig->rowCount == 1 || transposeConfig->columnCount == 1)
+    {
+        auto const size = transposeConfig->rowCount * transposeConfig->columnCount;
+        memmove_s(transposeConfig->output, size, transposeConfig->input, size);
+        return;
+    }
+    Transposition<int8_t>{ transposeConfig }.Run();
+}
+
+void TransposeKernelImpl2B(TransposeConfig const * const transposeConfig)
+{
+    if (transposeConfig->rowCount == 1 || transposeConfig->columnCount == 1)
+    {
+        auto const size = transposeConfig->rowCount * transposeConfig->columnCount * sizeof(int16_t);
+        memmove_s(transposeConfig->output, size, transposeConfig->input, size);
+        return;
+    }
+    Transposition<int16_t>{ transposeConfig }.Run();
+}
@@ -30,106 +30,79 @@ static void transposeN6(int16_t *input, int16_t *output, uint32_t M);
 static void transposeN7(int16_t *input, int16_t *output, uint32_t M);
 static void transposeN8(int16_t *input, int16_t *output, uint32_t M);
 
-static void transposeLarge(int16_t *input, int16_t *output, uint32_t M, uint32_t N);
-
 void TransposeKernelImpl(TransposeConfig const * const transposeConfig)
 {
     uint32_t M = transposeConfig->rowCount;
     uint32_t N = transposeConfig->columnCount;
-    const int16_t * const I = transposeConfig->input;
+    int16_t *in0 = const_cast<int16_t*>(transposeConfig->input);
     int16_t * const O = transposeConfig->output;
 
-    // input matrix is a vector - copy
-    if (M == 1 || N == 1)
-    {
-        memmove_s(O, M * N * sizeof(int16_t), I, M * N * sizeof(int16_t));
-        return;
-    }
-
-    // very small matrix - generic tranpose
-    // or N, M between 8 and 16 for large matrices - not implemented
-    if (M * N < VEC_16CAP * VEC_16CAP
-        || (N > 8 && N < 16) || (M > 8 && M < 16))
-    {
-        uint32_t i;
-        uint32_t j;
-        for (i = 0; i < M; i++)
-        {
-            for (j = 0; j < N; j++)
-            {
-                O[j * M + i] = I[i * N + j];
-            }
-        }
-
-        return;
-    }
-
-    int16_t *in0 = const_cast<int16_t*>(I);
-
     // INTERLEAVE
-    // MAX M is 8, MAX N is UINT16_MAX
-    if (N >= VEC_16CAP)
+    // MAX M is 8, N multiple of vector
+    if (N % VEC_16CAP == 0)
     {
         switch(M)
         {
             case 2:
                 transposeM2(in0, O, N);
-                break;
+                return;
             case 3:
                 transposeM3(in0, O, N);
-                break;
+                return;
             case 4:
                 transposeM4(in0, O, N);
-                break;
+                return;
             case 5:
                 transposeM5(in0, O, N);
-                break;
+                return;
             case 6:
                 transposeM6(in0, O, N);
-                break;
+                return;
             case 7:
                 transposeM7(in0, O, N);
-                break;
+                return;
             case 8:
                 transposeM8(in0, O, N);
-                break;
+                return;
             default:
                 break;
         }
     }
 
     // DEINTERLEAVE
-    // MAX N is 8, MAX M is UINT16_MAX
-    switch(N)
+    // MAX N is 8, M multiple of vector
+    if (M % VEC_16CAP == 0)
     {
-        case 2:
-            transposeN2(in0, O, M);
-            break;
-        case 3:
-            transposeN3(in0, O, M);
-            break;
-        case 4:
-            transposeN4(in0, O, M);
-            break;
-        case 5:
-            transposeN5(in0, O, M);
-            break;
-        case 6:
-            transposeN6(in0, O, M);
-            break;
-        case 7:
-            transposeN7(in0, O, M);
-            break;
-        case 8:
-            transposeN8(in0, O, M);
-            break;
+        switch(N)
+        {
+            case 2:
+                transposeN2(in0, O, M);
+                return;
+            case 3:
+                transposeN3(in0, O, M);
+                return;
+            case 4:
+                transposeN4(in0, O, M);
+                return;
+            case 5:
+                transposeN5(in0, O, M);
+                return;
+            case 6:
+                transposeN6(in0, O, M);
+                return;
+            case 7:
+                transposeN7(in0, O, M);
+                return;
+            case 8:
+                transposeN8(in0, O, M);
+                return;
+            default:
+                break;
+        }
     }
 
-    // for large matrices - some purpose in the future?
-    if (N >= VEC_16CAP && M >= VEC_16CAP)
-    {
-        transposeLarge(in0, O, M, N);
-    }
+    // vectors, remainders and large matrices
+    TransposeKernelImpl2B(transposeConfig);
 }
 
 void transposeM2(int16_t *input, int16_t *output, uint32_t N)
@@ -831,7 +804,7 @@ void transposeM8(int16_t *input, int16_t *output, uint32_t N)
 {
     uint32_t M = 8;
     uint32_t N_VEC = N - N % VEC_16CAP;
-    uint32_t M_VEC = M - M % VEC_16CAP;
+    uint32_t M_VEC = M; // all rows are transposed in vectors
     int16_t *in1 = input + N;
     int16_t *in2 = in1 + N;
     int16_t *in3 = in2 + N;
@@ -1605,247 +1578,3 @@ void transposeN8(int16_t *input, int16_t *output, uint32_t M)
         }
     }
 }
-
-void transposeLarge(int16_t *input, int16_t *output, uint32_t M, uint32_t N)
-{
-    // M, N end element that will be loaded to AVX vector
-    uint32_t N_VEC = N - N % VEC_16CAP;
-    uint32_t M_VEC = M - M % VEC_16CAP;
-
-    __m256i a, b, c, d, e, f, g, h, i, j, k, l, m, n, o, p;
-    __m256i ab_lo, cd_lo, ef_lo, gh_lo, ij_lo, kl_lo, mn_lo, op_lo;
-    __m256i ab_hi, cd_hi, ef_hi, gh_hi, ij_hi, kl_hi, mn_hi, op_hi;
-    __m256i abcd1, abcd5, abcd9, abcd13, efgh1, efgh5, efgh9, efgh13,
-            ijkl1, ijkl5, ijkl9, ijkl13, mnop1, mnop5, mnop9, mnop13,
-            ah1, ah3, ah5, ah7, ah9, ah11, ah13, ah15,
-            ip1, ip3, ip5, ip7, ip9, ip11, ip13, ip15,
-            ap1, ap2, ap3, ap4, ap5, ap6, ap7, ap8, ap9,
-            ap10, ap11, ap12, ap13, ap14, ap15, ap16;
-
-    int16_t *in1, *in2, *in3, *in4, *in5, *in6, *in7, *in8;
-    int16_t *in9, *in10, *in11, *in12, *in13, *in14, *in15;
-
-    int16_t *out0, *out1, *out2, *out3, *out4, *out5, *out6, *out7, *out8;
-    int16_t *out9, *out10, *out11, *out12, *out13, *out14, *out15;
-
-    uint32_t ii, jj;
-    out0 = output;
-    int16_t *input_end = input + M_VEC * N;
-    for (; input < input_end;)
-    {
-        in1 = input + N;
-        in2 = in1 + N;
-        in3 = in2 + N;
-        in4 = in3 + N;
-        in5 = in4 + N;
-        in6 = in5 + N;
-        in7 = in6 + N;
-        in8 = in7 + N;
-        in9 = in8 + N;
-        in10 = in9 + N;
-        in11 = in10 + N;
-        in12 = in11 + N;
-        in13 = in12 + N;
-        in14 = in13 + N;
-        in15 = in14 + N;
-
-        a = _mm256_lddqu_si256((__m256i*)input);
-        b = _mm256_lddqu_si256((__m256i*)in1);
-        c = _mm256_lddqu_si256((__m256i*)in2);
-        d = _mm256_lddqu_si256((__m256i*)in3);
-        e = _mm256_lddqu_si256((__m256i*)in4);
-        f = _mm256_lddqu_si256((__m256i*)in5);
-        g = _mm256_lddqu_si256((__m256i*)in6);
-        h = _mm256_lddqu_si256((__m256i*)in7);
-        i = _mm256_lddqu_si256((__m256i*)in8);
-        j = _mm256_lddqu_si256((__m256i*)in9);
-        k = _mm256_lddqu_si256((__m256i*)in10);
-        l = _mm256_lddqu_si256((__m256i*)in11);
-        m = _mm256_lddqu_si256((__m256i*)in12);
-        n = _mm256_lddqu_si256((__m256i*)in13);
-        o = _mm256_lddqu_si256((__m256i*)in14);
-        p = _mm256_lddqu_si256((__m256i*)in15);
-
-        out1 = out0 + M,
-             out2 = out1 + M,
-             out3 = out2 + M,
-             out4 = out3 + M,
-             out5 = out4 + M,
-             out6 = out5 + M,
-             out7 = out6 + M,
-             out8 = out7 + M,
-             out9 = out8 + M,
-             out10 = out9 + M,
-             out11 = out10 + M,
-             out12 = out11 + M,
-             out13 = out12 + M,
-             out14 = out13 + M,
-             out15 = out14 + M;
-
-        int16_t *col_end = input + N_VEC;
-
-        for (; input < col_end;)
-        {
-            input += VEC_16CAP;
-            in1 += VEC_16CAP;
-            in2 += VEC_16CAP;
-            in3 += VEC_16CAP;
-            in4 += VEC_16CAP;
-            in5 += VEC_16CAP;
-            in6 += VEC_16CAP;
-            in7 += VEC_16CAP;
-            in8 += VEC_16CAP;
-            in9 += VEC_16CAP;
-            in10 += VEC_16CAP;
-            in11 += VEC_16CAP;
-            in12 += VEC_16CAP;
-            in13 += VEC_16CAP;
-            in14 += VEC_16CAP;
-            in15 += VEC_16CAP;
-
-            ab_lo = _mm256_unpacklo_epi16(a, b);
-            cd_lo = _mm256_unpacklo_epi16(c, d);
-            ef_lo = _mm256_unpacklo_epi16(e, f);
-            gh_lo = _mm256_unpacklo_epi16(g, h);
-            ij_lo = _mm256_unpacklo_epi16(i, j);
-            kl_lo = _mm256_unpacklo_epi16(k, l);
-            mn_lo = _mm256_unpacklo_epi16(m, n);
-            op_lo = _mm256_unpacklo_epi16(o, p);
-
-            ab_hi = _mm256_unpackhi_epi16(a, b);
-            cd_hi = _mm256_unpackhi_epi16(c, d);
-            ef_hi = _mm256_unpackhi_epi16(e, f);
-            gh_hi = _mm256_unpackhi_epi16(g, h);
-            ij_hi = _mm256_unpackhi_epi16(i, j);
-            kl_hi = _mm256_unpackhi_epi16(k, l);
-            mn_hi = _mm256_unpackhi_epi16(m, n);
-            op_hi = _mm256_unpackhi_epi16(o, p);
-
-            abcd1 = _mm256_unpacklo_epi32(ab_lo, cd_lo);
-            abcd5 = _mm256_unpackhi_epi32(ab_lo, cd_lo);
-            abcd9 = _mm256_unpacklo_epi32(ab_hi, cd_hi);
-            abcd13 = _mm256_unpackhi_epi32(ab_hi, cd_hi);
-
-            efgh1 = _mm256_unpacklo_epi32(ef_lo, gh_lo);
-            efgh5 = _mm256_unpackhi_epi32(ef_lo, gh_lo);
-            efgh9 = _mm256_unpacklo_epi32(ef_hi, gh_hi);
-            efgh13 = _mm256_unpackhi_epi32(ef_hi, gh_hi);
-
-            ijkl1 = _mm256_unpacklo_epi32(ij_lo, kl_lo);
-            ijkl5 = _mm256_unpackhi_epi32(ij_lo, kl_lo);
-            ijkl9 = _mm256_unpacklo_epi32(ij_hi, kl_hi);
-            ijkl13 = _mm256_unpackhi_epi32(ij_hi, kl_hi);
-
-            mnop1 = _mm256_unpacklo_epi32(mn_lo, op_lo);
-            mnop5 = _mm256_unpackhi_epi32(mn_lo, op_lo);
-            mnop9 = _mm256_unpacklo_epi32(mn_hi, op_hi);
-            mnop13 = _mm256_unpackhi_epi32(mn_hi, op_hi);
-
-            ah1 = _mm256_unpacklo_epi64(abcd1, efgh1);
-            ah3 = _mm256_unpackhi_epi64(abcd1, efgh1);
-            ah5 = _mm256_unpacklo_epi64(abcd5, efgh5);
-            ah7 = _mm256_unpackhi_epi64(abcd5, efgh5);
-            ah9 = _mm256_unpacklo_epi64(abcd9, efgh9);
-            ah11 = _mm256_unpackhi_epi64(abcd9, efgh9);
-            ah13 = _mm256_unpacklo_epi64(abcd13, efgh13);
-            ah15 = _mm256_unpackhi_epi64(abcd13, efgh13);
-
-            ip1 = _mm256_unpacklo_epi64(ijkl1, mnop1);
-            ip3 = _mm256_unpackhi_epi64(ijkl1, mnop1);
-            ip5 = _mm256_unpacklo_epi64(ijkl5, mnop5);
-            ip7 = _mm256_unpackhi_epi64(ijkl5, mnop5);
-            ip9 = _mm256_unpacklo_epi64(ijkl9, mnop9);
-            ip11 = _mm256_unpackhi_epi64(ijkl9, mnop9);
-            ip13 = _mm256_unpacklo_epi64(ijkl13, mnop13);
-            ip15 = _mm256_unpackhi_epi64(ijkl13, mnop13);
-
-            ap1 = _mm256_permute2x128_si256(ah1, ip1, 32);
-            ap2 = _mm256_permute2x128_si256(ah1, ip1, 49);
-            ap3 = _mm256_permute2x128_si256(ah3, ip3, 32);
-            ap4 = _mm256_permute2x128_si256(ah3, ip3, 49);
-            ap5 = _mm256_permute2x128_si256(ah5, ip5, 32);
-            ap6 = _mm256_permute2x128_si256(ah5, ip5, 49);
-            ap7 = _mm256_permute2x128_si256(ah7, ip7, 32);
-            ap8 = _mm256_permute2x128_si256(ah7, ip7, 49);
-            ap9 = _mm256_permute2x128_si256(ah9, ip9, 32);
-            ap10 = _mm256_permute2x128_si256(ah9, ip9, 49);
-            ap11 = _mm256_permute2x128_si256(ah11, ip11, 32);
-            ap12 = _mm256_permute2x128_si256(ah11, ip11, 49);
-            ap13 = _mm256_permute2x128_si256(ah13, ip13, 32);
-            ap14 = _mm256_permute2x128_si256(ah13, ip13, 49);
-            ap15 = _mm256_permute2x128_si256(ah15, ip15, 32);
-            ap16 = _mm256_permute2x128_si256(ah15, ip15, 49);
-
-            _mm256_storeu_si256((__m256i*)out0, ap1);
-            _mm256_storeu_si256((__m256i*)out1, ap3);
-            _mm256_storeu_si256((__m256i*)out2, ap5);
-            _mm256_storeu_si256((__m256i*)out3, ap7);
-            _mm256_storeu_si256((__m256i*)out4, ap9);
-            _mm256_storeu_si256((__m256i*)out5, ap11);
-            _mm256_storeu_si256((__m256i*)out6, ap13);
-            _mm256_storeu_si256((__m256i*)out7, ap15);
-            _mm256_storeu_si256((__m256i*)out8, ap2);
-            _mm256_storeu_si256((__m256i*)out9, ap4);
-            _mm256_storeu_si256((__m256i*)out10, ap6);
-            _mm256_storeu_si256((__m256i*)out11, ap8);
-            _mm256_storeu_si256((__m256i*)out12, ap10);
-            _mm256_storeu_si256((__m256i*)out13, ap12);
-            _mm256_storeu_si256((__m256i*)out14, ap14);
-            _mm256_storeu_si256((__m256i*)out15, ap16);
-
-            out0 += M * VEC_16CAP;
-            out1 += M * VEC_16CAP;
-            out2 += M * VEC_16CAP;
-            out3 += M * VEC_16CAP;
-            out4 += M * VEC_16CAP;
-            out5 += M * VEC_16CAP;
-            out6 += M * VEC_16CAP;
-            out7 += M * VEC_16CAP;
-            out8 += M * VEC_16CAP;
-            out9 += M * VEC_16CAP;
-            out10 += M * VEC_16CAP;
-            out11 += M * VEC_16CAP;
-            out12 += M * VEC_16CAP;
-            out13 += M * VEC_16CAP;
-            out14 += M * VEC_16CAP;
-            out15 += M * VEC_16CAP;
-
-            a = _mm256_lddqu_si256((__m256i*)input);
-            b = _mm256_lddqu_si256((__m256i*)in1);
-            c = _mm256_lddqu_si256((__m256i*)in2);
-            d = _mm256_lddqu_si256((__m256i*)in3);
-            e = _mm256_lddqu_si256((__m256i*)in4);
-            f = _mm256_lddqu_si256((__m256i*)in5);
-            g = _mm256_lddqu_si256((__m256i*)in6);
-            h = _mm256_lddqu_si256((__m256i*)in7);
-            i = _mm256_lddqu_si256((__m256i*)in8);
-            j = _mm256_lddqu_si256((__m256i*)in9);
-            k = _mm256_lddqu_si256((__m256i*)in10);
-            l = _mm256_lddqu_si256((__m256i*)in11);
-            m = _mm256_lddqu_si256((__m256i*)in12);
-            n = _mm256_lddqu_si256((__m256i*)in13);
-            o = _mm256_lddqu_si256((__m256i*)in14);
-            p = _mm256_lddqu_si256((__m256i*)in15);
-        }
-
-        input = input - N_VEC + VEC_16CAP * N;
-        out0 = out0 - N_VEC * M + VEC_16CAP;
-    }
-
-    for (ii = M_VEC; ii < M; ii++)
-    {
-        for (jj = 0; jj < N_VEC; jj++)
-        {
-            output[jj * M + ii] = input[ii * N + jj];
-        }
-
-    }
-
-    for (ii = N_VEC; ii < N; ii++)
-    {
-        for (jj = 0; jj < M; jj++)
-        {
-            output[ii * M + jj] = input[jj * N + ii];
-        }
-    }
-}
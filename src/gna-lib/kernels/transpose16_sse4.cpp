@@ -33,90 +33,75 @@ void TransposeKernelImpl(TransposeConfig const * const transposeConfig)
 {
     uint32_t M = transposeConfig->rowCount;
     uint32_t N = transposeConfig->columnCount;
-    const int16_t * const I = transposeConfig->input;
+    int16_t *in0 = const_cast<int16_t*>(transposeConfig->input);
     int16_t * const O = transposeConfig->output;
 
-    // input matrix is a vector - copy
-    if (M == 1 || N == 1)
-    {
-        memmove_s(O, M * N * sizeof(int16_t), I, M * N * sizeof(int16_t));
-        return;
-    }
-
-    // very small matrix - generic tranpose
-    if (M * N < VEC_16CAP * VEC_16CAP)
-    {
-        for (uint32_t i = 0; i < M; i++)
-        {
-            for (uint32_t j = 0; j < N; j++)
-            {
-                O[j * M + i] = I[i * N + j];
-            }
-        }
-
-        return;
-    }
-
-    int16_t *in0 = const_cast<int16_t*>(I);
-
     // INTERLEAVE
-    // MAX M is 8, MAX N is UINT16_MAX
-    if (N >= VEC_16CAP)
+    // MAX M is 8, N multiple of vector
+    if (N % VEC_16CAP == 0)
     {
         switch(M)
         {
             case 2:
                 transposeM2(in0, O, N);
-                break;
+                return;
             case 3:
                 transposeM3(in0, O, N);
-                break;
+                return;
             case 4:
                 transposeM4(in0, O, N);
-                break;
+                return;
             case 5:
                 transposeM5(in0, O, N);
-                break;
+                return;
             case 6:
                 transposeM6(in0, O, N);
-                break;
+                return;
             case 7:
                 transposeM7(in0, O, N);
-                break;
+                return;
             case 8:
                 transposeM8(in0, O, N);
-                break;
+                return;
             default:
                 break;
         }
     }
 
     // DEINTERLEAVE
-    // MAX N is 8, MAX M is UINT16_MAX
-    switch(N)
+    // MAX N is 8, M multiple of vector
+    if (M % VEC_16CAP == 0)
     {
-        case 2:
-            transposeN2(in0, O, M);
-            break;
-        case 3:
-            transposeN3(in0, O, M);
-            break;
-        case 4:
-            transposeN4(in0, O, M);
-            break;
-        case 5:
-            transposeN5(in0, O, M);
-            break;
-        case 6:
-            transposeN6(in0, O, M);
-            break;
-        case 7:
-            transposeN7(in0, O, M);
-            break;
-        case 8:
-            transposeN8(in0, O, M);
-            break;
+        switch(N)
+        {
+            case 2:
+                transposeN2(in0, O, M);
+                return;
+            case 3:
+                transposeN3(in0, O, M);
+                return;
+            case 4:
+                transposeN4(in0, O, M);
+                return;
+            case 5:
+                transposeN5(in0, O, M);
+                return;
+            case 6:
+                transposeN6(in0, O, M);
+                return;
+            case 7:
+                transposeN7(in0, O, M);
+                return;
+            case 8:
+                transposeN8(in0, O, M);
+                return;
+            default:
+                break;
+        }
     }
+
+    // vectors, remainders and large matrices
+    TransposeKernelImpl2B(transposeConfig);
 }
 
 void transposeM2(int16_t *input, int16_t *output, uint32_t N)